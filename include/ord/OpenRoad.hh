@@ -235,7 +235,8 @@ class OpenRoad
   // to notify the tools (eg dbSta, gui).
   void designCreated();
 
-  void readDb(const char* filename);
+  // With lazy, wires and parasitics are read from filename on first use.
+  void readDb(const char* filename, bool lazy = false);
   void writeDb(const char* filename);
 
   void diffDbs(const char* filename1, const char* filename2, const char* diffs);
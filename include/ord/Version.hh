@@ -0,0 +1,5 @@
+#define OPENROAD_VERSION "080cfd5d34789c6515657c4fd50bdf865b9d217b"
+
+#define OPENROAD_GIT_DESCRIBE ""
+
+/* #undef BUILD_OPENPHYSYN */
@@ -328,6 +328,9 @@ void OpenRoad::readDef(const char* filename,
   if (continue_on_errors) {
     def_reader.continueOnErrors();
   }
+  if (getThreadCount() > 1) {
+    def_reader.useNetBuilderThread();
+  }
   dbBlock* block = nullptr;
   if (child) {
     auto parent = db_->getChip()->getBlock();
@@ -376,6 +379,7 @@ void OpenRoad::writeDef(const char* filename, const string& version)
     if (block) {
       odb::defout def_writer(logger_);
       def_writer.setVersion(stringToDefVersion(version));
+      def_writer.setNumThreads(getThreadCount());
       def_writer.writeBlock(block, filename);
     }
   }
@@ -454,19 +458,23 @@ void OpenRoad::writeCdl(const char* outFilename,
   }
 }
 
-void OpenRoad::readDb(const char* filename)
+void OpenRoad::readDb(const char* filename, bool lazy)
 {
   if (db_->getChip() && db_->getChip()->getBlock()) {
     logger_->error(
         ORD, 47, "You can't load a new db file as the db is already populated");
   }
 
-  std::ifstream stream;
-  stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
-                    | std::ios::eofbit);
-  stream.open(filename, std::ios::binary);
+  if (lazy) {
+    db_->readLazy(filename);
+  } else {
+    std::ifstream stream;
+    stream.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                      | std::ios::eofbit);
+    stream.open(filename, std::ios::binary);
 
-  db_->read(stream);
+    db_->read(stream);
+  }
 
   for (OpenRoadObserver* observer : observers_) {
     observer->postReadDb(db_);
@@ -475,6 +483,8 @@ void OpenRoad::readDb(const char* filename)
 
 void OpenRoad::writeDb(const char* filename)
 {
+  // filename may be the file a lazy read_db is still loading from.
+  db_->loadLazySections();
   FILE* stream = fopen(filename, "w");
   if (stream) {
     db_->write(stream);
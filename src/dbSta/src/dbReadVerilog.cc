@@ -35,8 +35,12 @@
 
 #include "db_sta/dbReadVerilog.hh"
 
+#include <algorithm>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "db_sta/dbNetwork.hh"
 #include "odb/db.h"
@@ -47,6 +51,7 @@
 #include "sta/Vector.hh"
 #include "sta/VerilogReader.hh"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 
 namespace ord {
 
@@ -147,6 +152,8 @@ class Verilog2db
   void makeDbNets(const Instance* inst);
   bool hasTerminals(Net* net) const;
   dbMaster* getMaster(Cell* cell);
+  dbMTerm* getMTerm(dbMaster* master, const Port* port);
+  dbInst* findDbInst(const Instance* inst) const;
   dbModule* makeUniqueDbModule(const char* name);
 
   Network* network_;
@@ -154,6 +161,10 @@ class Verilog2db
   dbBlock* block_ = nullptr;
   Logger* logger_;
   std::map<Cell*, dbMaster*> master_map_;
+  std::unordered_map<const Port*, dbMTerm*> mterm_map_;
+  // Leaf instances in creation order, sorted before makeDbNets so pins
+  // can be mapped to dbInsts without building their path names.
+  std::vector<std::pair<const Instance*, dbInst*>> db_insts_;
   std::map<std::string, int> uniquify_id_;  // key: module name
 };
 
@@ -216,9 +227,21 @@ void Verilog2db::makeBlock()
 
 void Verilog2db::makeDbNetlist()
 {
+  utl::Timer timer;
   recordBusPortsOrder();
   makeDbModule(network_->topInstance(), /* parent */ nullptr);
+  std::sort(db_insts_.begin(), db_insts_.end());
   makeDbNets(network_->topInstance());
+  db_insts_.clear();
+  db_insts_.shrink_to_fit();
+  debugPrint(logger_,
+             ORD,
+             "link",
+             1,
+             "made {} insts and {} nets in {:.2f}s",
+             block_->getInsts().size(),
+             block_->getNets().size(),
+             timer.elapsed());
 }
 
 void Verilog2db::recordBusPortsOrder()
@@ -308,6 +331,7 @@ void Verilog2db::makeDbModule(Instance* inst, dbModule* parent)
         continue;
       }
       module->addInst(db_inst);
+      db_insts_.emplace_back(child, db_inst);
     }
   }
   delete child_iter;
@@ -377,13 +401,10 @@ void Verilog2db::makeDbNets(const Instance* inst)
             bterm->setIoType(io_type);
           }
         } else if (network_->isLeaf(pin)) {
-          const char* port_name = network_->portName(pin);
-          Instance* inst = network_->instance(pin);
-          const char* inst_name = network_->pathName(inst);
-          dbInst* db_inst = block_->findInst(inst_name);
+          dbInst* db_inst = findDbInst(network_->instance(pin));
           if (db_inst) {
-            dbMaster* master = db_inst->getMaster();
-            dbMTerm* mterm = master->findMTerm(block_, port_name);
+            dbMTerm* mterm
+                = getMTerm(db_inst->getMaster(), network_->port(pin));
             if (mterm) {
               db_inst->getITerm(mterm)->connect(db_net);
             }
@@ -436,4 +457,27 @@ dbMaster* Verilog2db::getMaster(Cell* cell)
   return nullptr;
 }
 
+// Cached by port since every instance of a cell shares the same ports.
+dbMTerm* Verilog2db::getMTerm(dbMaster* master, const Port* port)
+{
+  auto it = mterm_map_.find(port);
+  if (it != mterm_map_.end()) {
+    return it->second;
+  }
+  dbMTerm* mterm = master->findMTerm(block_, network_->name(port));
+  mterm_map_[port] = mterm;
+  return mterm;
+}
+
+dbInst* Verilog2db::findDbInst(const Instance* inst) const
+{
+  auto it = std::lower_bound(db_insts_.begin(),
+                             db_insts_.end(),
+                             std::make_pair(inst, (dbInst*) nullptr));
+  if (it != db_insts_.end() && it->first == inst) {
+    return it->second;
+  }
+  return nullptr;
+}
+
 }  // namespace ord
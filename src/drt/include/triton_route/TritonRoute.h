@@ -31,6 +31,7 @@
 #include <tcl.h>
 
 #include <boost/asio/thread_pool.hpp>
+#include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -95,6 +96,9 @@ struct ParamStruct
   int minAccessPoints = -1;
   bool saveGuideUpdates = false;
   std::string repairPDNLayerName;
+  bool dependencyScheduling = false;
+  std::string paCacheFile;
+  std::string outputStageStatsFile;
 };
 
 class TritonRoute
@@ -149,6 +153,7 @@ class TritonRoute
   void setSharedVolume(const std::string& vol);
   void setCloudSize(unsigned int cloud_sz) { cloud_sz_ = cloud_sz; }
   unsigned int getCloudSize() const { return cloud_sz_; }
+  void setDistBatchFile(bool on) { dist_batch_file_ = on; }
   void setDebugPaEdge(bool on = true);
   void setDebugPaCommit(bool on = true);
   void reportConstraints();
@@ -203,6 +208,7 @@ class TritonRoute
   std::mutex results_mutex_;
   int results_sz_;
   unsigned int cloud_sz_;
+  bool dist_batch_file_;
   boost::asio::thread_pool dist_pool_;
 
   void initDesign();
@@ -212,6 +218,15 @@ class TritonRoute
   void applyUpdates(const std::vector<std::vector<fr::drUpdate>>& updates);
   void getDRCMarkers(std::list<std::unique_ptr<fr::frMarker>>& markers,
                      const odb::Rect& requiredDrcBox);
+  // Checks requiredDrcBox in parallel tiles and passes the markers to
+  // handleBatch as each batch of tiles completes.
+  void getDRCMarkers(
+      const odb::Rect& requiredDrcBox,
+      const std::function<void(std::list<std::unique_ptr<fr::frMarker>>&)>&
+          handleBatch);
+  void writeDRC(std::ostream& drcRpt,
+                const std::list<std::unique_ptr<fr::frMarker>>& markers,
+                const odb::Rect& drcBox);
   void stackVias(odb::dbBTerm* bterm,
                  int top_layer_idx,
                  int bterm_bottom_layer_idx,
@@ -57,6 +57,7 @@
 #include "sta/StaMain.hh"
 #include "stt/SteinerTreeBuilder.h"
 #include "ta/FlexTA.h"
+#include "utl/exception.h"
 using namespace std;
 using namespace fr;
 using namespace triton_route;
@@ -83,6 +84,7 @@ TritonRoute::TritonRoute()
       dist_port_(0),
       results_sz_(0),
       cloud_sz_(0),
+      dist_batch_file_(false),
       dist_pool_(1)
 {
 }
@@ -588,8 +590,10 @@ void TritonRoute::dr()
   num_drvs_ = -1;
   dr_ = std::make_unique<FlexDR>(this, getDesign(), logger_, db_);
   dr_->setDebug(debug_.get());
-  if (distributed_)
+  if (distributed_) {
     dr_->setDistributed(dist_, dist_ip_, dist_port_, shared_volume_);
+    dr_->setDistBatchFile(dist_batch_file_);
+  }
   if (SINGLE_STEP_DR) {
     dr_->init();
   } else {
@@ -849,6 +853,7 @@ int TritonRoute::main()
     FlexPA pa(getDesign(), logger_, dist_);
     pa.setDistributed(dist_ip_, dist_port_, shared_volume_, cloud_sz_);
     pa.setDebug(debug_.get(), db_);
+    pa.setCache(PA_CACHE_FILE, db_);
     pa_pool.join();
     pa.main();
     if (distributed_ || debug_->debugDR || debug_->debugDumpDR) {
@@ -909,6 +914,7 @@ void TritonRoute::pinAccess(std::vector<odb::dbInst*> target_insts)
   FlexPA pa(getDesign(), logger_, dist_);
   pa.setTargetInstances(target_insts);
   pa.setDebug(debug_.get(), db_);
+  pa.setCache(PA_CACHE_FILE, db_);
   if (distributed_) {
     pa.setDistributed(dist_ip_, dist_port_, shared_volume_, cloud_sz_);
     dist_pool_.join();
@@ -920,74 +926,90 @@ void TritonRoute::pinAccess(std::vector<odb::dbInst*> target_insts)
 
 void TritonRoute::getDRCMarkers(frList<std::unique_ptr<frMarker>>& markers,
                                 const Rect& requiredDrcBox)
+{
+  getDRCMarkers(requiredDrcBox,
+                [&markers](frList<std::unique_ptr<frMarker>>& batch) {
+                  markers.splice(markers.end(), batch);
+                });
+}
+
+void TritonRoute::getDRCMarkers(
+    const Rect& requiredDrcBox,
+    const std::function<void(frList<std::unique_ptr<frMarker>>&)>& handleBatch)
 {
   MAX_THREADS = ord::OpenRoad::openRoad()->getThreadCount();
-  std::vector<std::vector<std::unique_ptr<FlexGCWorker>>> workersBatches(1);
-  auto size = 7;
-  auto offset = 0;
-  auto gCellPatterns = design_->getTopBlock()->getGCellPatterns();
+  const int size = 7;
+  auto block = design_->getTopBlock();
+  auto gCellPatterns = block->getGCellPatterns();
   auto& xgp = gCellPatterns.at(0);
   auto& ygp = gCellPatterns.at(1);
-  for (int i = offset; i < (int) xgp.getCount(); i += size) {
-    for (int j = offset; j < (int) ygp.getCount(); j += size) {
-      Rect routeBox1 = design_->getTopBlock()->getGCellBox(Point(i, j));
-      const int max_i = min((int) xgp.getCount() - 1, i + size - 1);
-      const int max_j = min((int) ygp.getCount(), j + size - 1);
-      Rect routeBox2 = design_->getTopBlock()->getGCellBox(Point(max_i, max_j));
-      Rect routeBox(routeBox1.xMin(),
-                    routeBox1.yMin(),
-                    routeBox2.xMax(),
-                    routeBox2.yMax());
-      Rect extBox;
+  auto getTileBoxes = [&](const Point& tile, Rect& drcBox, Rect& extBox) {
+    const int max_i = min((int) xgp.getCount() - 1, tile.x() + size - 1);
+    const int max_j = min((int) ygp.getCount() - 1, tile.y() + size - 1);
+    Rect routeBox1 = block->getGCellBox(tile);
+    Rect routeBox2 = block->getGCellBox(Point(max_i, max_j));
+    Rect routeBox(routeBox1.xMin(),
+                  routeBox1.yMin(),
+                  routeBox2.xMax(),
+                  routeBox2.yMax());
+    routeBox.bloat(DRCSAFEDIST, drcBox);
+    routeBox.bloat(MTSAFEDIST, extBox);
+  };
+  std::vector<Point> tiles;
+  for (int i = 0; i < (int) xgp.getCount(); i += size) {
+    for (int j = 0; j < (int) ygp.getCount(); j += size) {
       Rect drcBox;
-      routeBox.bloat(DRCSAFEDIST, drcBox);
-      routeBox.bloat(MTSAFEDIST, extBox);
-      if (!drcBox.intersects(requiredDrcBox))
-        continue;
-      auto gcWorker
-          = std::make_unique<FlexGCWorker>(design_->getTech(), logger_);
-      gcWorker->setDrcBox(drcBox);
-      gcWorker->setExtBox(extBox);
-      if (workersBatches.back().size() >= BATCHSIZE)
-        workersBatches.push_back(std::vector<std::unique_ptr<FlexGCWorker>>());
-      workersBatches.back().push_back(std::move(gcWorker));
+      Rect extBox;
+      getTileBoxes(Point(i, j), drcBox, extBox);
+      if (drcBox.intersects(requiredDrcBox)) {
+        tiles.emplace_back(i, j);
+      }
     }
   }
-  std::map<MarkerId, frMarker*> mapMarkers;
+
   omp_set_num_threads(MAX_THREADS);
-  for (auto& workers : workersBatches) {
+  for (int begin = 0; begin < (int) tiles.size(); begin += BATCHSIZE) {
+    const int batchSize = min(BATCHSIZE, (int) tiles.size() - begin);
+    std::vector<frList<std::unique_ptr<frMarker>>> tileMarkers(batchSize);
+    utl::ThreadException exception;
 #pragma omp parallel for schedule(dynamic)
-    for (int i = 0; i < workers.size(); i++) {
-      workers[i]->init(design_.get());
-      workers[i]->main();
-    }
-    for (const auto& worker : workers) {
-      for (auto& marker : worker->getMarkers()) {
-        Rect bbox = marker->getBBox();
-        if (!bbox.intersects(requiredDrcBox))
-          continue;
-        auto layerNum = marker->getLayerNum();
-        auto con = marker->getConstraint();
-        std::vector<frBlockObject*> srcs(2, nullptr);
-        int i = 0;
-        for (auto& src : marker->getSrcs()) {
-          srcs.at(i) = src;
-          i++;
-        }
-        if (mapMarkers.find({bbox, layerNum, con, srcs[0], srcs[1]})
-            != mapMarkers.end()) {
-          continue;
-        }
-        if (mapMarkers.find({bbox, layerNum, con, srcs[1], srcs[0]})
-            != mapMarkers.end()) {
-          continue;
+    for (int k = 0; k < batchSize; k++) {
+      try {
+        const Point& tile = tiles[begin + k];
+        Rect drcBox;
+        Rect extBox;
+        getTileBoxes(tile, drcBox, extBox);
+        FlexGCWorker worker(design_->getTech(), logger_);
+        worker.setDrcBox(drcBox);
+        worker.setExtBox(extBox);
+        worker.init(design_.get());
+        worker.main();
+        for (auto& marker : worker.getMarkers()) {
+          const Rect bbox = marker->getBBox();
+          if (!bbox.intersects(requiredDrcBox)) {
+            continue;
+          }
+          // Tiles overlap by their halo so a marker near a tile boundary
+          // is found more than once.  Only the tile holding its lower left
+          // corner reports it.
+          const Point owner
+              = block->getGCellIdx(bbox.intersect(requiredDrcBox).ll());
+          if (owner.x() / size != tile.x() / size
+              || owner.y() / size != tile.y() / size) {
+            continue;
+          }
+          tileMarkers[k].push_back(std::make_unique<frMarker>(*marker));
         }
-        markers.push_back(std::make_unique<frMarker>(*marker));
-        mapMarkers[{bbox, layerNum, con, srcs[0], srcs[1]}]
-            = markers.back().get();
+      } catch (...) {
+        exception.capture();
       }
     }
-    workers.clear();
+    exception.rethrow();
+    frList<std::unique_ptr<frMarker>> markers;
+    for (auto& tileMarker : tileMarkers) {
+      markers.splice(markers.end(), tileMarker);
+    }
+    handleBatch(markers);
   }
 }
 
@@ -1002,9 +1024,19 @@ void TritonRoute::checkDRC(const char* filename, int x1, int y1, int x2, int y2)
   if (requiredDrcBox.area() == 0) {
     requiredDrcBox = design_->getTopBlock()->getBBox();
   }
-  frList<std::unique_ptr<frMarker>> markers;
-  getDRCMarkers(markers, requiredDrcBox);
-  reportDRC(filename, markers, requiredDrcBox);
+  // Markers are written as each batch of tiles completes rather than
+  // collected for the whole block first.
+  ofstream drcRpt(filename);
+  if (!drcRpt.is_open()) {
+    logger_->error(DRT, 624, "Unable to open DRC report file {}.", filename);
+  }
+  int numMarkers = 0;
+  getDRCMarkers(requiredDrcBox,
+                [&](frList<std::unique_ptr<frMarker>>& markers) {
+                  writeDRC(drcRpt, markers, requiredDrcBox);
+                  numMarkers += markers.size();
+                });
+  logger_->info(DRT, 625, "Found {} DRC violations.", numMarkers);
 }
 
 void TritonRoute::processBTermsAboveTopLayer(bool has_routing)
@@ -1178,6 +1210,9 @@ void TritonRoute::setParams(const ParamStruct& params)
   }
   SAVE_GUIDE_UPDATES = params.saveGuideUpdates;
   REPAIR_PDN_LAYER_NAME = params.repairPDNLayerName;
+  DEPENDENCY_SCHEDULING = params.dependencyScheduling;
+  PA_CACHE_FILE = params.paCacheFile;
+  STAGE_STATS_FILE = params.outputStageStatsFile;
 }
 
 void TritonRoute::addWorkerResults(
@@ -1210,8 +1245,6 @@ void TritonRoute::reportDRC(const string& file_name,
                             const frList<std::unique_ptr<frMarker>>& markers,
                             Rect drcBox)
 {
-  double dbu = getDesign()->getTech()->getDBUPerUU();
-
   if (file_name == string("")) {
     if (VERBOSE > 0) {
       logger_->warn(
@@ -1223,75 +1256,82 @@ void TritonRoute::reportDRC(const string& file_name,
   }
   ofstream drcRpt(file_name.c_str());
   if (drcRpt.is_open()) {
-    for (const auto& marker : markers) {
-      // get violation bbox
-      Rect bbox = marker->getBBox();
-      if (drcBox != Rect() && !drcBox.intersects(bbox))
-        continue;
-      auto tech = getDesign()->getTech();
-      auto layer = tech->getLayer(marker->getLayerNum());
-      auto layerType = layer->getType();
-
-      auto con = marker->getConstraint();
-      drcRpt << "  violation type: ";
-      if (con) {
-        std::string violName;
-        if (con->typeId() == frConstraintTypeEnum::frcShortConstraint
-            && layerType == dbTechLayerType::CUT)
-          violName = "Cut Short";
-        else
-          violName = con->getViolName();
-        drcRpt << violName;
-      } else {
-        drcRpt << "nullptr";
-      }
-      drcRpt << endl;
-      // get source(s) of violation
-      // format: type:name/identifier
-      drcRpt << "    srcs: ";
-      for (auto src : marker->getSrcs()) {
-        if (src) {
-          switch (src->typeId()) {
-            case frcNet:
-              drcRpt << "net:" << (static_cast<frNet*>(src))->getName() << " ";
-              break;
-            case frcInstTerm: {
-              frInstTerm* instTerm = (static_cast<frInstTerm*>(src));
-              drcRpt << "iterm:" << instTerm->getInst()->getName() << "/"
-                     << instTerm->getTerm()->getName() << " ";
-              break;
-            }
-            case frcBTerm: {
-              frBTerm* bterm = (static_cast<frBTerm*>(src));
-              drcRpt << "bterm:" << bterm->getName() << " ";
-              break;
-            }
-            case frcInstBlockage: {
-              frInstBlockage* instBlockage
-                  = (static_cast<frInstBlockage*>(src));
-              drcRpt << "inst:" << instBlockage->getInst()->getName() << " ";
-              break;
-            }
-            case frcBlockage: {
-              drcRpt << "obstruction: ";
-              break;
-            }
-            default:
-              logger_->error(DRT,
-                             291,
-                             "Unexpected source type in marker: {}",
-                             src->typeId());
+    writeDRC(drcRpt, markers, drcBox);
+  } else {
+    cout << "Error: Fail to open DRC report file\n";
+  }
+}
+
+void TritonRoute::writeDRC(std::ostream& drcRpt,
+                           const frList<std::unique_ptr<frMarker>>& markers,
+                           const Rect& drcBox)
+{
+  double dbu = getDesign()->getTech()->getDBUPerUU();
+  for (const auto& marker : markers) {
+    // get violation bbox
+    Rect bbox = marker->getBBox();
+    if (drcBox != Rect() && !drcBox.intersects(bbox))
+      continue;
+    auto tech = getDesign()->getTech();
+    auto layer = tech->getLayer(marker->getLayerNum());
+    auto layerType = layer->getType();
+
+    auto con = marker->getConstraint();
+    drcRpt << "  violation type: ";
+    if (con) {
+      std::string violName;
+      if (con->typeId() == frConstraintTypeEnum::frcShortConstraint
+          && layerType == dbTechLayerType::CUT)
+        violName = "Cut Short";
+      else
+        violName = con->getViolName();
+      drcRpt << violName;
+    } else {
+      drcRpt << "nullptr";
+    }
+    drcRpt << endl;
+    // get source(s) of violation
+    // format: type:name/identifier
+    drcRpt << "    srcs: ";
+    for (auto src : marker->getSrcs()) {
+      if (src) {
+        switch (src->typeId()) {
+          case frcNet:
+            drcRpt << "net:" << (static_cast<frNet*>(src))->getName() << " ";
+            break;
+          case frcInstTerm: {
+            frInstTerm* instTerm = (static_cast<frInstTerm*>(src));
+            drcRpt << "iterm:" << instTerm->getInst()->getName() << "/"
+                   << instTerm->getTerm()->getName() << " ";
+            break;
+          }
+          case frcBTerm: {
+            frBTerm* bterm = (static_cast<frBTerm*>(src));
+            drcRpt << "bterm:" << bterm->getName() << " ";
+            break;
+          }
+          case frcInstBlockage: {
+            frInstBlockage* instBlockage = (static_cast<frInstBlockage*>(src));
+            drcRpt << "inst:" << instBlockage->getInst()->getName() << " ";
+            break;
           }
+          case frcBlockage: {
+            drcRpt << "obstruction: ";
+            break;
+          }
+          default:
+            logger_->error(DRT,
+                           291,
+                           "Unexpected source type in marker: {}",
+                           src->typeId());
         }
       }
-      drcRpt << "\n";
-
-      drcRpt << "    bbox = ( " << bbox.xMin() / dbu << ", "
-             << bbox.yMin() / dbu << " ) - ( " << bbox.xMax() / dbu << ", "
-             << bbox.yMax() / dbu << " ) on Layer ";
-      drcRpt << layer->getName() << "\n";
     }
-  } else {
-    cout << "Error: Fail to open DRC report file\n";
+    drcRpt << "\n";
+
+    drcRpt << "    bbox = ( " << bbox.xMin() / dbu << ", " << bbox.yMin() / dbu
+           << " ) - ( " << bbox.xMax() / dbu << ", " << bbox.yMax() / dbu
+           << " ) on Layer ";
+    drcRpt << layer->getName() << "\n";
   }
 }
@@ -54,13 +54,15 @@ int detailed_route_num_drvs()
 void detailed_route_distributed(const char* remote_ip,
                                 unsigned short remote_port,
                                 const char* sharedVolume,
-                                unsigned int cloud_sz)
+                                unsigned int cloud_sz,
+                                bool batch_file)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   router->setDistributed(true);
   router->setWorkerIpPort(remote_ip, remote_port);
   router->setSharedVolume(sharedVolume);
   router->setCloudSize(cloud_sz);
+  router->setDistBatchFile(batch_file);
 }
 
 void detailed_route_set_default_via(const char* viaName)
@@ -95,7 +97,10 @@ void detailed_route_cmd(const char* outputMazeFile,
                         int minAccessPoints,
                         bool saveGuideUpdates,
                         const char* repairPDNLayerName,
-                        int drcReportIterStep)
+                        int drcReportIterStep,
+                        bool dependencyScheduling,
+                        const char* paCacheFile,
+                        const char* outputStageStatsFile)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   std::optional<int> drcReportIterStepOpt;
@@ -122,7 +127,10 @@ void detailed_route_cmd(const char* outputMazeFile,
                     singleStepDR,
                     minAccessPoints,
                     saveGuideUpdates,
-                    repairPDNLayerName});
+                    repairPDNLayerName,
+                    dependencyScheduling,
+                    paCacheFile,
+                    outputStageStatsFile});
   router->main();
   router->setDistributed(false);
 }
@@ -131,7 +139,8 @@ void pin_access_cmd(const char* dbProcessNode,
                     const char* bottomRoutingLayer,
                     const char* topRoutingLayer,
                     int verbose,
-                    int minAccessPoints)
+                    int minAccessPoints,
+                    const char* paCacheFile)
 {
   auto* router = ord::OpenRoad::openRoad()->getTritonRoute();
   triton_route::ParamStruct params;
@@ -140,6 +149,7 @@ void pin_access_cmd(const char* dbProcessNode,
   params.topRoutingLayer = topRoutingLayer;
   params.verbose = verbose;
   params.minAccessPoints = minAccessPoints;
+  params.paCacheFile = paCacheFile;
   router->setParams(params);
   router->pinAccess();
   router->setDistributed(false);
@@ -38,6 +38,7 @@ sta::define_cmd_args "detailed_route" {
     [-output_drc filename]
     [-output_cmap filename]
     [-output_guide_coverage filename]
+    [-output_stage_stats filename]
     [-drc_report_iter_step step]
     [-db_process_node name]
     [-disable_via_gen]
@@ -54,21 +55,27 @@ sta::define_cmd_args "detailed_route" {
     [-remote_port rport]
     [-shared_volume vol]
     [-cloud_size sz]
+    [-batch_file]
     [-clean_patches]
     [-no_pin_access]
     [-min_access_points count]
     [-save_guide_updates]
     [-repair_pdn_vias layer]
+    [-dependency_scheduling]
+    [-pin_access_cache filename]
 }
 
 proc detailed_route { args } {
   sta::parse_key_args "detailed_route" args \
     keys {-output_maze -output_drc -output_cmap -output_guide_coverage \
+      -output_stage_stats \
       -db_process_node -droute_end_iter -via_in_pin_bottom_layer \
       -via_in_pin_top_layer -or_seed -or_k -bottom_routing_layer \
       -top_routing_layer -verbose -remote_host -remote_port -shared_volume \
-      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step} \
-    flags {-disable_via_gen -distributed -clean_patches -no_pin_access -single_step_dr -save_guide_updates}
+      -cloud_size -min_access_points -repair_pdn_vias -drc_report_iter_step \
+      -pin_access_cache} \
+    flags {-disable_via_gen -distributed -clean_patches -no_pin_access -single_step_dr -save_guide_updates \
+      -dependency_scheduling -batch_file}
   sta::check_argc_eq0 "detailed_route" $args
 
   set enable_via_gen [expr ![info exists flags(-disable_via_gen)]]
@@ -78,6 +85,7 @@ proc detailed_route { args } {
   # development.  It is not listed in the help string intentionally.
   set single_step_dr  [expr [info exists flags(-single_step_dr)]]
   set save_guide_updates  [expr [info exists flags(-save_guide_updates)]]
+  set dependency_scheduling [expr [info exists flags(-dependency_scheduling)]]
 
   if { [info exists keys(-repair_pdn_vias)] } {
     set repair_pdn_vias $keys(-repair_pdn_vias)
@@ -89,6 +97,16 @@ proc detailed_route { args } {
   } else {
     set output_maze ""
   }
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
+  if { [info exists keys(-output_stage_stats)] } {
+    set output_stage_stats $keys(-output_stage_stats)
+  } else {
+    set output_stage_stats ""
+  }
   if { [info exists keys(-output_drc)] } {
     set output_drc $keys(-output_drc)
   } else {
@@ -182,7 +200,8 @@ proc detailed_route { args } {
     } else {
       utl::error DRT 516 "-cloud_size is required for distributed routing."
     }
-    drt::detailed_route_distributed $rhost $rport $vol $cloudsz
+    set batch_file [info exists flags(-batch_file)]
+    drt::detailed_route_distributed $rhost $rport $vol $cloudsz $batch_file
   }
   if { [info exists keys(-min_access_points)] } {
     sta::check_cardinal "-min_access_points" $keys(-min_access_points)
@@ -195,7 +214,8 @@ proc detailed_route { args } {
     $via_in_pin_bottom_layer $via_in_pin_top_layer \
     $or_seed $or_k $bottom_routing_layer $top_routing_layer $verbose \
     $clean_patches $no_pin_access $single_step_dr $min_access_points \
-    $save_guide_updates $repair_pdn_vias $drc_report_iter_step
+    $save_guide_updates $repair_pdn_vias $drc_report_iter_step \
+    $dependency_scheduling $pin_access_cache $output_stage_stats
 }
 
 proc detailed_route_num_drvs { args } {
@@ -290,11 +310,13 @@ sta::define_cmd_args "pin_access" {
     [-remote_port rport]
     [-shared_volume vol]
     [-cloud_size sz]
+    [-pin_access_cache filename]
 }
 proc pin_access { args } {
   sta::parse_key_args "pin_access" args \
       keys {-db_process_node -bottom_routing_layer -top_routing_layer -verbose \
-            -min_access_points -remote_host -remote_port -shared_volume -cloud_size } \
+            -min_access_points -remote_host -remote_port -shared_volume -cloud_size \
+            -pin_access_cache } \
       flags {-distributed}
   sta::check_argc_eq0 "detailed_route_debug" $args
   if [info exists keys(-db_process_node)] {
@@ -324,6 +346,11 @@ proc pin_access { args } {
   } else {
     set min_access_points -1
   }
+  if { [info exists keys(-pin_access_cache)] } {
+    set pin_access_cache $keys(-pin_access_cache)
+  } else {
+    set pin_access_cache ""
+  }
   if { [info exists flags(-distributed)] } {
     if { [info exists keys(-remote_host)] } {
       set rhost $keys(-remote_host)
@@ -345,9 +372,9 @@ proc pin_access { args } {
     } else {
       utl::error DRT 555 "-cloud_size is required for distributed routing."
     }
-    drt::detailed_route_distributed $rhost $rport $vol $cloudsz
+    drt::detailed_route_distributed $rhost $rport $vol $cloudsz 0
   }
-  drt::pin_access_cmd $db_process_node $bottom_routing_layer $top_routing_layer $verbose $min_access_points
+  drt::pin_access_cmd $db_process_node $bottom_routing_layer $top_routing_layer $verbose $min_access_points $pin_access_cache
 }
 
 sta::define_cmd_args "detailed_route_run_worker" {
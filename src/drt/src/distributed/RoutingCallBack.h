@@ -41,6 +41,7 @@
 #include "distributed/PinAccessJobDescription.h"
 #include "distributed/RoutingJobDescription.h"
 #include "distributed/frArchive.h"
+#include "distributed/workerBatch.h"
 #include "dr/FlexDR.h"
 #include "dst/Distributed.h"
 #include "dst/JobCallBack.h"
@@ -80,7 +81,19 @@ class RoutingCallBack : public dst::JobCallBack
       init_ = false;
       omp_set_num_threads(ord::OpenRoad::openRoad()->getThreadCount());
     }
-    auto workers = desc->getWorkers();
+    std::vector<std::pair<int, std::string>> workers;
+    if (desc->hasWorkersFile()) {
+      if (!readWorkersFile(desc, workers)) {
+        logger_->error(utl::DRT,
+                       628,
+                       "Failed to read worker batch {}.",
+                       desc->getWorkersPath());
+      }
+    } else {
+      workers = desc->getWorkers();
+    }
+    // Reply the same way the batch was sent.
+    const std::string& results_path = desc->getWorkersPath();
     int size = workers.size();
     std::vector<std::pair<int, std::string>> results;
     asio::thread_pool reply_pool(1);
@@ -104,14 +117,15 @@ class RoutingCallBack : public dst::JobCallBack
                                    results,
                                    boost::ref(sock),
                                    false,
-                                   cnt));
+                                   cnt,
+                                   results_path));
             results.clear();
           }
         }
       }
     }
     reply_pool.join();
-    sendResult(results, sock, true, cnt);
+    sendResult(results, sock, true, cnt, results_path);
   }
 
   void onFrDesignUpdated(dst::JobMessage& msg, dst::socket& sock) override
@@ -221,7 +235,8 @@ class RoutingCallBack : public dst::JobCallBack
   void sendResult(std::vector<std::pair<int, std::string>> results,
                   dst::socket& sock,
                   bool finish,
-                  int cnt)
+                  int cnt,
+                  const std::string& workers_path)
   {
     dst::JobMessage result;
     if (finish)
@@ -230,7 +245,17 @@ class RoutingCallBack : public dst::JobCallBack
       result.setJobType(dst::JobMessage::NONE);
     auto uResultDesc = std::make_unique<RoutingJobDescription>();
     auto resultDesc = static_cast<RoutingJobDescription*>(uResultDesc.get());
-    resultDesc->setWorkers(results);
+    if (!workers_path.empty()) {
+      const std::string path
+          = finish ? fmt::format("{}.res", workers_path)
+                   : fmt::format("{}.res{}", workers_path, cnt);
+      if (!writeWorkersFile(path, results, resultDesc)) {
+        logger_->error(
+            utl::DRT, 629, "Failed to write worker results {}.", path);
+      }
+    } else {
+      resultDesc->setWorkers(results);
+    }
     result.setJobDescription(std::move(uResultDesc));
     dist_->sendResult(result, sock);
     if (finish)
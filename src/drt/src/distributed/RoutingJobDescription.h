@@ -28,7 +28,9 @@
 
 #pragma once
 #include <boost/serialization/base_object.hpp>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "dst/JobMessage.h"
 namespace boost::serialization {
@@ -48,6 +50,16 @@ class RoutingJobDescription : public dst::JobDescription
   {
     workers_ = workers;
   }
+  // Workers passed through a file on the shared volume instead of inline.
+  // Worker i occupies [offsets[i], offsets[i + 1]) of the file.
+  void setWorkersFile(const std::string& path,
+                      const std::vector<int>& ids,
+                      const std::vector<uint64_t>& offsets)
+  {
+    workers_path_ = path;
+    worker_ids_ = ids;
+    worker_offsets_ = offsets;
+  }
   void setUpdates(const std::vector<std::string>& updates)
   {
     updates_ = updates;
@@ -63,6 +75,13 @@ class RoutingJobDescription : public dst::JobDescription
   {
     return workers_;
   }
+  bool hasWorkersFile() const { return !workers_path_.empty(); }
+  const std::string& getWorkersPath() const { return workers_path_; }
+  const std::vector<int>& getWorkerIds() const { return worker_ids_; }
+  const std::vector<uint64_t>& getWorkerOffsets() const
+  {
+    return worker_offsets_;
+  }
   const std::vector<std::string>& getUpdates() { return updates_; }
   bool isDesignUpdate() const { return design_update_; }
   int getSendEvery() const { return send_every_; }
@@ -74,6 +93,9 @@ class RoutingJobDescription : public dst::JobDescription
   std::string shared_dir_;
   std::string guide_path_;
   std::vector<std::pair<int, std::string>> workers_;
+  std::string workers_path_;
+  std::vector<int> worker_ids_;
+  std::vector<uint64_t> worker_offsets_;
   std::vector<std::string> updates_;
   std::string via_data_;
   bool design_update_;
@@ -88,6 +110,9 @@ class RoutingJobDescription : public dst::JobDescription
     (ar) & shared_dir_;
     (ar) & guide_path_;
     (ar) & workers_;
+    (ar) & workers_path_;
+    (ar) & worker_ids_;
+    (ar) & worker_offsets_;
     (ar) & updates_;
     (ar) & via_data_;
     (ar) & design_update_;
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "distributed/workerBatch.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <fstream>
+
+#include "distributed/RoutingJobDescription.h"
+
+namespace fr {
+
+bool writeWorkersFile(const std::string& path,
+                      const std::vector<std::pair<int, std::string>>& workers,
+                      RoutingJobDescription* desc)
+{
+  std::ofstream file(path, std::ios_base::binary);
+  if (!file.good()) {
+    return false;
+  }
+  std::vector<int> ids;
+  std::vector<uint64_t> offsets;
+  ids.reserve(workers.size());
+  offsets.reserve(workers.size() + 1);
+  offsets.push_back(0);
+  for (const auto& [id, worker] : workers) {
+    file.write(worker.data(), worker.size());
+    ids.push_back(id);
+    offsets.push_back(offsets.back() + worker.size());
+  }
+  file.close();
+  if (!file) {
+    return false;
+  }
+  desc->setWorkersFile(path, ids, offsets);
+  return true;
+}
+
+bool readWorkersFile(const RoutingJobDescription* desc,
+                     std::vector<std::pair<int, std::string>>& workers)
+{
+  const auto& ids = desc->getWorkerIds();
+  const auto& offsets = desc->getWorkerOffsets();
+  if (offsets.size() != ids.size() + 1) {
+    return false;
+  }
+  const int fd = open(desc->getWorkersPath().c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || (uint64_t) st.st_size != offsets.back()) {
+    close(fd);
+    return false;
+  }
+  const size_t size = st.st_size;
+  if (size == 0) {
+    close(fd);
+    for (int id : ids) {
+      workers.emplace_back(id, std::string());
+    }
+    return true;
+  }
+  void* data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED) {
+    return false;
+  }
+  const char* base = static_cast<const char*>(data);
+  workers.reserve(workers.size() + ids.size());
+  for (size_t i = 0; i < ids.size(); i++) {
+    workers.emplace_back(
+        ids[i], std::string(base + offsets[i], offsets[i + 1] - offsets[i]));
+  }
+  munmap(data, size);
+  return true;
+}
+
+}  // namespace fr
@@ -32,20 +32,26 @@
 #include <omp.h>
 #include <stdio.h>
 
+#include <algorithm>
 #include <boost/archive/text_iarchive.hpp>
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/io/ios_state.hpp>
 #include <chrono>
+#include <condition_variable>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <numeric>
+#include <queue>
 #include <sstream>
 
 #include "db/infra/frTime.h"
 #include "distributed/RoutingJobDescription.h"
 #include "distributed/frArchive.h"
+#include "distributed/workerBatch.h"
 #include "dr/FlexDR_conn.h"
 #include "dr/FlexDR_graphics.h"
+#include "dr/FlexDR_stats.h"
 #include "dst/BalancerJobDescription.h"
 #include "dst/Distributed.h"
 #include "frProfileTask.h"
@@ -113,6 +119,8 @@ FlexDR::FlexDR(triton_route::TritonRoute* router,
       dist_(nullptr),
       dist_on_(false),
       dist_port_(0),
+      dist_batch_file_(false),
+      dist_batch_cnt_(0),
       increaseClipsize_(false),
       clipSizeInc_(0),
       iter_(0)
@@ -161,6 +169,14 @@ void serializeUpdates(const std::vector<std::vector<drUpdate>>& updates,
   file.close();
 }
 
+std::shared_lock<std::shared_mutex> FlexDRWorker::readLockDesign() const
+{
+  if (design_mutex_ == nullptr) {
+    return std::shared_lock<std::shared_mutex>();
+  }
+  return std::shared_lock<std::shared_mutex>(*design_mutex_);
+}
+
 int FlexDRWorker::main(frDesign* design)
 {
   ProfileTask profile("DRW:main");
@@ -174,6 +190,7 @@ int FlexDRWorker::main(frDesign* design)
                     routeBox_.xMax() * micronPerDBU,
                     routeBox_.yMax() * micronPerDBU);
   }
+  auto design_lock = readLockDesign();
   initMarkers(design);
   if (getDRIter() && getInitNumMarkers() == 0 && !needRecheck_) {
     skipRouting_ = true;
@@ -208,6 +225,9 @@ int FlexDRWorker::main(frDesign* design)
   if (!skipRouting_) {
     init(design);
   }
+  if (design_lock.owns_lock()) {
+    design_lock.unlock();
+  }
   high_resolution_clock::time_point t1 = high_resolution_clock::now();
   if (!skipRouting_) {
     route_queue();
@@ -221,6 +241,11 @@ int FlexDRWorker::main(frDesign* design)
   duration<double> time_span1 = duration_cast<duration<double>>(t2 - t1);
   duration<double> time_span2 = duration_cast<duration<double>>(t3 - t2);
 
+  FlexDRStageStats::add(FlexDRStageStats::INIT, time_span0);
+  if (!skipRouting_) {
+    FlexDRStageStats::add(FlexDRStageStats::ROUTE_QUEUE, time_span1);
+  }
+
   if (VERBOSE > 1) {
     stringstream ss;
     ss << "time (INIT/ROUTE/POST) " << time_span0.count() << " "
@@ -467,6 +492,9 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
   if (ripupMode != 1 && getDesign()->getTopBlock()->getMarkers().empty()) {
     return;
   }
+  // Drop anything timed outside of an iteration.
+  FlexDRStageStats::collect();
+  const auto iterStart = chrono::steady_clock::now();
   if (dist_on_) {
     if ((iter % 10 == 0 && iter != 60) || iter == 3 || iter == 15) {
       globals_path_ = fmt::format("{}globals.{}.ar", dist_dir_, iter);
@@ -494,8 +522,6 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
   auto& xgp = gCellPatterns.at(0);
   auto& ygp = gCellPatterns.at(1);
   int cnt = 0;
-  int tot = (((int) xgp.getCount() - 1 - offset) / size + 1)
-            * (((int) ygp.getCount() - 1 - offset) / size + 1);
   int prev_perc = 0;
   bool isExceed = false;
 
@@ -504,22 +530,45 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
 
   getBatchInfo(batchStepX, batchStepY);
 
+  const vector<vector<bool>> activeWorkers
+      = getActiveWorkers(iter, size, offset, batchStepX, batchStepY);
+  int tot = 0;
+  for (const auto& column : activeWorkers) {
+    tot += std::count(column.begin(), column.end(), true);
+  }
+  debugPrint(logger_,
+             utl::DRT,
+             "workers",
+             1,
+             "Building {} of {} workers.",
+             tot,
+             activeWorkers.size() * activeWorkers[0].size());
+
+  // The dependency scheduler lets workers commit while others are still
+  // routing, which the distributed flow and the debug graphics can't do.
+  const bool dependencyScheduling
+      = DEPENDENCY_SCHEDULING && !dist_on_ && graphics_ == nullptr;
   vector<vector<vector<unique_ptr<FlexDRWorker>>>> workers(batchStepX
                                                            * batchStepY);
+  vector<vector<unique_ptr<FlexDRWorker>>> workerGrid;
+  if (dependencyScheduling) {
+    workerGrid.resize(activeWorkers.size());
+    for (auto& column : workerGrid) {
+      column.resize(activeWorkers[0].size());
+    }
+  }
 
   int xIdx = 0, yIdx = 0;
   for (int i = offset; i < (int) xgp.getCount(); i += size) {
     for (int j = offset; j < (int) ygp.getCount(); j += size) {
+      if (!activeWorkers[xIdx][yIdx]) {
+        yIdx++;
+        continue;
+      }
       auto worker = make_unique<FlexDRWorker>(&via_data_, design_, logger_);
-      Rect routeBox1 = getDesign()->getTopBlock()->getGCellBox(Point(i, j));
       const int max_i = min((int) xgp.getCount() - 1, i + size - 1);
       const int max_j = min((int) ygp.getCount(), j + size - 1);
-      Rect routeBox2
-          = getDesign()->getTopBlock()->getGCellBox(Point(max_i, max_j));
-      Rect routeBox(routeBox1.xMin(),
-                    routeBox1.yMin(),
-                    routeBox2.xMax(),
-                    routeBox2.yMax());
+      const Rect routeBox = getWorkerRouteBox(i, j, size);
       Rect extBox;
       Rect drcBox;
       routeBox.bloat(MTSAFEDIST, extBox);
@@ -550,6 +599,11 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
                       workerFixedShapeCost,
                       workerMarkerDecay);
 
+      if (dependencyScheduling) {
+        workerGrid[xIdx][yIdx] = std::move(worker);
+        yIdx++;
+        continue;
+      }
       int batchIdx = (xIdx % batchStepX) * batchStepY + yIdx % batchStepY;
       if (workers[batchIdx].empty()
           || (!dist_on_
@@ -564,10 +618,35 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
     xIdx++;
   }
 
+  auto workerDone = [&]() {
+    cnt++;
+    if (VERBOSE > 0) {
+      if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1 && prev_perc < 90) {
+        if (prev_perc == 0 && t.isExceed(0)) {
+          isExceed = true;
+        }
+        prev_perc += 10;
+        if (isExceed) {
+          logger_->report("    Completing {}% with {} violations.",
+                          prev_perc,
+                          getDesign()->getTopBlock()->getNumMarkers());
+          logger_->report("    {}.", t);
+        }
+      }
+    }
+  };
+
   omp_set_num_threads(MAX_THREADS);
   int version = 0;
   increaseClipsize_ = false;
   numWorkUnits_ = 0;
+  const auto scheduleStart = chrono::steady_clock::now();
+  // Worker time per thread, used to report the thread utilization.
+  vector<double> threadBusy(MAX_THREADS, 0.0);
+  if (dependencyScheduling) {
+    threadBusy[0] = runWorkersByDependency(
+        workerGrid, batchStepX, batchStepY, workerDone);
+  }
   // parallel execution
   for (auto& workerBatch : workers) {
     ProfileTask profile("DR:checkerboard");
@@ -593,30 +672,16 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
 #pragma omp parallel for schedule(dynamic)
           for (int i = 0; i < (int) workersInBatch.size(); i++) {
             try {
+              const auto start = chrono::steady_clock::now();
               if (dist_on_)
                 workersInBatch[i]->distributedMain(getDesign());
               else
                 workersInBatch[i]->main(getDesign());
+              const chrono::duration<double> busy
+                  = chrono::steady_clock::now() - start;
+              threadBusy[omp_get_thread_num()] += busy.count();
 #pragma omp critical
-              {
-                cnt++;
-                if (VERBOSE > 0) {
-                  if (cnt * 1.0 / tot >= prev_perc / 100.0 + 0.1
-                      && prev_perc < 90) {
-                    if (prev_perc == 0 && t.isExceed(0)) {
-                      isExceed = true;
-                    }
-                    prev_perc += 10;
-                    if (isExceed) {
-                      logger_->report(
-                          "    Completing {}% with {} violations.",
-                          prev_perc,
-                          getDesign()->getTopBlock()->getNumMarkers());
-                      logger_->report("    {}.", t);
-                    }
-                  }
-                }
-              }
+              workerDone();
             } catch (...) {
               exception.capture();
             }
@@ -657,6 +722,7 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
       }
       {
         ProfileTask profile("DR:end_batch");
+        const auto start = chrono::steady_clock::now();
         // single thread
         for (int i = 0; i < (int) workersInBatch.size(); i++) {
           if (workersInBatch[i]->end(getDesign()))
@@ -665,9 +731,32 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
             increaseClipsize_ = true;
         }
         workersInBatch.clear();
+        const chrono::duration<double> busy
+            = chrono::steady_clock::now() - start;
+        threadBusy[0] += busy.count();
       }
     }
   }
+  if (!dist_on_) {
+    const chrono::duration<double> wall
+        = chrono::steady_clock::now() - scheduleStart;
+    const double busy
+        = std::accumulate(threadBusy.begin(), threadBusy.end(), 0.0);
+    const double capacity = wall.count() * MAX_THREADS;
+    debugPrint(logger_,
+               utl::DRT,
+               "workers",
+               1,
+               "Thread utilization {:.1f}% ({:.2f}s busy, {:.2f}s wall, {} "
+               "threads).",
+               capacity > 0 ? 100.0 * busy / capacity : 0.0,
+               busy,
+               wall.count(),
+               MAX_THREADS);
+  }
+  // The next iteration uses a different worker size.
+#pragma omp parallel
+  FlexGridGraph::releaseArena();
 
   if (!iter) {
     removeGCell2BoundaryPin();
@@ -700,6 +789,18 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
              1,
              "Number of work units = {}.",
              numWorkUnits_);
+  {
+    FlexDRStageStats::Iteration stats;
+    stats.iter = iter;
+    stats.seconds = chrono::duration<double>(chrono::steady_clock::now()
+                                             - iterStart)
+                        .count();
+    stats.num_work_units = numWorkUnits_;
+    stats.num_markers = getDesign()->getTopBlock()->getNumMarkers();
+    stats.counters = FlexDRStageStats::collect();
+    FlexDRStageStats::report(stats, logger_);
+    stageStats_.push_back(stats);
+  }
   if (VERBOSE > 0) {
     logger_->info(DRT,
                   199,
@@ -754,6 +855,201 @@ void FlexDR::searchRepair(const SearchRepairArgs& args)
   }
 }
 
+Rect FlexDR::getWorkerRouteBox(const int i, const int j, const int size) const
+{
+  auto gCellPatterns = getDesign()->getTopBlock()->getGCellPatterns();
+  auto& xgp = gCellPatterns.at(0);
+  auto& ygp = gCellPatterns.at(1);
+  Rect routeBox1 = getDesign()->getTopBlock()->getGCellBox(Point(i, j));
+  const int max_i = min((int) xgp.getCount() - 1, i + size - 1);
+  const int max_j = min((int) ygp.getCount(), j + size - 1);
+  Rect routeBox2
+      = getDesign()->getTopBlock()->getGCellBox(Point(max_i, max_j));
+  return Rect(
+      routeBox1.xMin(), routeBox1.yMin(), routeBox2.xMax(), routeBox2.yMax());
+}
+
+vector<vector<bool>> FlexDR::getActiveWorkers(const int iter,
+                                              const int size,
+                                              const int offset,
+                                              const int batchStepX,
+                                              const int batchStepY)
+{
+  auto gCellPatterns = getDesign()->getTopBlock()->getGCellPatterns();
+  const int numX = ((int) gCellPatterns.at(0).getCount() - 1 - offset) / size
+                   + 1;
+  const int numY = ((int) gCellPatterns.at(1).getCount() - 1 - offset) / size
+                   + 1;
+  // Workers only skip routing for lack of markers from the third
+  // iteration on (see FlexDRWorker::initMarkers).
+  vector<vector<bool>> active(numX, vector<bool>(numY, iter < 2));
+  if (iter < 2) {
+    return active;
+  }
+  for (int x = 0; x < numX; x++) {
+    for (int y = 0; y < numY; y++) {
+      Rect drcBox;
+      getWorkerRouteBox(offset + x * size, offset + y * size, size)
+          .bloat(DRCSAFEDIST, drcBox);
+      vector<frMarker*> markers;
+      getRegionQuery()->queryMarker(drcBox, markers);
+      active[x][y] = !markers.empty();
+    }
+  }
+  // A worker also sees the markers committed by the overlapping
+  // neighbors that run before it, so activity spreads along the
+  // checkerboard order. Skipping the rest builds exactly the workers
+  // that would not skip routing.
+  auto color = [&](int x, int y) {
+    return (x % batchStepX) * batchStepY + y % batchStepY;
+  };
+  for (int c = 0; c < batchStepX * batchStepY; c++) {
+    for (int x = 0; x < numX; x++) {
+      for (int y = 0; y < numY; y++) {
+        if (color(x, y) != c || active[x][y]) {
+          continue;
+        }
+        for (int nx = max(0, x - 1); nx <= min(numX - 1, x + 1); nx++) {
+          for (int ny = max(0, y - 1); ny <= min(numY - 1, y + 1); ny++) {
+            if (color(nx, ny) < c && active[nx][ny]) {
+              active[x][y] = true;
+            }
+          }
+        }
+      }
+    }
+  }
+  return active;
+}
+
+double FlexDR::runWorkersByDependency(
+    vector<vector<unique_ptr<FlexDRWorker>>>& workers,
+    const int batchStepX,
+    const int batchStepY,
+    const std::function<void()>& workerDone)
+{
+  ProfileTask profile("DR:dependency_schedule");
+  // Flatten the grid in checkerboard order so that a single thread
+  // reproduces the batch order exactly.
+  const int numX = workers.size();
+  const int numY = numX > 0 ? workers[0].size() : 0;
+  auto color = [&](int x, int y) {
+    return (x % batchStepX) * batchStepY + y % batchStepY;
+  };
+  vector<pair<int, int>> order;
+  order.reserve(numX * numY);
+  for (int c = 0; c < batchStepX * batchStepY; c++) {
+    for (int x = 0; x < numX; x++) {
+      for (int y = 0; y < numY; y++) {
+        if (color(x, y) == c && workers[x][y] != nullptr) {
+          order.emplace_back(x, y);
+        }
+      }
+    }
+  }
+  vector<vector<int>> rank(numX, vector<int>(numY, -1));
+  for (int i = 0; i < (int) order.size(); i++) {
+    rank[order[i].first][order[i].second] = i;
+  }
+
+  // Neighboring workers overlap through their ext boxes. The one with
+  // the lower checkerboard color must commit before the other starts,
+  // as it would with a barrier between colors. Workers that don't
+  // touch are independent.
+  vector<int> pending(order.size(), 0);
+  vector<vector<int>> successors(order.size());
+  for (int x = 0; x < numX; x++) {
+    for (int y = 0; y < numY; y++) {
+      if (rank[x][y] < 0) {
+        continue;
+      }
+      for (int nx = max(0, x - 1); nx <= min(numX - 1, x + 1); nx++) {
+        for (int ny = max(0, y - 1); ny <= min(numY - 1, y + 1); ny++) {
+          if (rank[nx][ny] >= 0 && color(nx, ny) < color(x, y)) {
+            successors[rank[nx][ny]].push_back(rank[x][y]);
+            pending[rank[x][y]]++;
+          }
+        }
+      }
+    }
+  }
+
+  // Lowest rank first keeps the execution close to the batch order.
+  std::priority_queue<int, vector<int>, std::greater<int>> ready;
+  for (int i = 0; i < (int) order.size(); i++) {
+    if (pending[i] == 0) {
+      ready.push(i);
+    }
+  }
+
+  // Routing only reads the design; commits need it exclusively.
+  std::shared_mutex design_mutex;
+  std::mutex queue_mutex;
+  std::condition_variable queue_cv;
+  int committed = 0;
+  bool abort = false;
+  double busy = 0;
+  ThreadException exception;
+#pragma omp parallel
+  {
+    double threadBusy = 0;
+    while (true) {
+      int idx;
+      {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        queue_cv.wait(lock, [&] {
+          return abort || !ready.empty() || committed == (int) order.size();
+        });
+        if (abort || ready.empty()) {
+          break;
+        }
+        idx = ready.top();
+        ready.pop();
+      }
+      try {
+        const auto start = chrono::steady_clock::now();
+        auto& worker = workers[order[idx].first][order[idx].second];
+        worker->setDesignMutex(&design_mutex);
+        worker->main(getDesign());
+        {
+          std::unique_lock<std::shared_mutex> lock(design_mutex);
+          if (worker->end(getDesign())) {
+            numWorkUnits_ += 1;
+          }
+          if (worker->isCongested()) {
+            increaseClipsize_ = true;
+          }
+          workerDone();
+        }
+        worker.reset();
+        const chrono::duration<double> elapsed
+            = chrono::steady_clock::now() - start;
+        threadBusy += elapsed.count();
+      } catch (...) {
+        exception.capture();
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        abort = true;
+        queue_cv.notify_all();
+        break;
+      }
+      {
+        std::unique_lock<std::mutex> lock(queue_mutex);
+        committed++;
+        for (int succ : successors[idx]) {
+          if (--pending[succ] == 0) {
+            ready.push(succ);
+          }
+        }
+      }
+      queue_cv.notify_all();
+    }
+#pragma omp critical
+    busy += threadBusy;
+  }
+  exception.rethrow();
+  return busy;
+}
+
 void FlexDR::end(bool done)
 {
   if (done && DRC_RPT_FILE != string("")) {
@@ -1145,6 +1441,11 @@ int FlexDR::main()
   end(/* done */ true);
   if (!GUIDE_REPORT_FILE.empty())
     reportGuideCoverage();
+  if (!STAGE_STATS_FILE.empty()
+      && !FlexDRStageStats::writeJSON(STAGE_STATS_FILE, stageStats_)) {
+    logger_->warn(
+        DRT, 630, "Failed to write stage stats to {}.", STAGE_STATS_FILE);
+  }
   if (VERBOSE > 0) {
     t.print(logger_);
     cout << endl;
@@ -1184,13 +1485,31 @@ void FlexDR::sendWorkers(
     }
   }
   {
+    const auto start = chrono::steady_clock::now();
+    uint64_t bytes_sent = 0;
+    uint64_t bytes_received = 0;
     dst::JobMessage msg(dst::JobMessage::ROUTING),
         result(dst::JobMessage::NONE);
     std::unique_ptr<dst::JobDescription> desc
         = std::make_unique<RoutingJobDescription>();
     RoutingJobDescription* rjd
         = static_cast<RoutingJobDescription*>(desc.get());
-    rjd->setWorkers(workers);
+    for (const auto& [idx, workerStr] : workers) {
+      bytes_sent += workerStr.size();
+    }
+    std::string workers_path;
+    if (dist_batch_file_) {
+      int batch_id;
+#pragma omp atomic capture
+      batch_id = dist_batch_cnt_++;
+      workers_path = fmt::format("{}workers_{}.bin", dist_dir_, batch_id);
+      if (!writeWorkersFile(workers_path, workers, rjd)) {
+        logger_->error(
+            utl::DRT, 626, "Failed to write worker batch {}.", workers_path);
+      }
+    } else {
+      rjd->setWorkers(workers);
+    }
     rjd->setSharedDir(dist_dir_);
     rjd->setSendEvery(20);
     msg.setJobDescription(std::move(desc));
@@ -1203,8 +1522,41 @@ void FlexDR::sendWorkers(
     for (const auto& one_desc : result.getAllJobDescriptions()) {
       RoutingJobDescription* result_desc
           = static_cast<RoutingJobDescription*>(one_desc.get());
-      router_->addWorkerResults(result_desc->getWorkers());
+      std::vector<std::pair<int, std::string>> results;
+      if (result_desc->hasWorkersFile()) {
+        if (!readWorkersFile(result_desc, results)) {
+          logger_->error(utl::DRT,
+                         627,
+                         "Failed to read worker results {}.",
+                         result_desc->getWorkersPath());
+        }
+        std::remove(result_desc->getWorkersPath().c_str());
+      } else {
+        results = result_desc->getWorkers();
+      }
+      for (const auto& [idx, workerStr] : results) {
+        bytes_received += workerStr.size();
+      }
+      router_->addWorkerResults(results);
+    }
+    if (!workers_path.empty()) {
+      std::remove(workers_path.c_str());
     }
+    const chrono::duration<double> elapsed
+        = chrono::steady_clock::now() - start;
+    debugPrint(logger_,
+               utl::DRT,
+               "dist",
+               1,
+               "Batch of {} workers to {}:{} ({}): {} bytes sent, {} bytes "
+               "received in {:.3f}s.",
+               workers.size(),
+               remote_ip,
+               remote_port,
+               dist_batch_file_ ? "batch file" : "inline",
+               bytes_sent,
+               bytes_received,
+               elapsed.count());
   }
 }
 
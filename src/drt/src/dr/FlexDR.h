@@ -33,11 +33,14 @@
 #include <boost/polygon/polygon.hpp>
 #include <boost/serialization/export.hpp>
 #include <deque>
+#include <functional>
 #include <memory>
+#include <shared_mutex>
 
 #include "db/drObj/drMarker.h"
 #include "db/drObj/drNet.h"
 #include "dr/FlexDR_graphics.h"
+#include "dr/FlexDR_stats.h"
 #include "dr/FlexGridGraph.h"
 #include "dr/FlexWavefront.h"
 #include "dst/JobMessage.h"
@@ -132,6 +135,8 @@ class FlexDR
     dist_port_ = remote_port;
     dist_dir_ = dir;
   }
+  // Pass worker batches through files on the shared volume.
+  void setDistBatchFile(bool on) { dist_batch_file_ = on; }
   void sendWorkers(
       const std::vector<std::pair<int, FlexDRWorker*>>& remote_batch,
       std::vector<std::unique_ptr<FlexDRWorker>>& batch);
@@ -150,6 +155,7 @@ class FlexDR
 
   FlexDRViaData via_data_;
   std::vector<int> numViols_;
+  std::vector<FlexDRStageStats::Iteration> stageStats_;
   std::unique_ptr<FlexDRGraphics> graphics_;
   std::string debugNetName_;
   int numWorkUnits_;
@@ -160,6 +166,8 @@ class FlexDR
   std::string dist_ip_;
   unsigned short dist_port_;
   std::string dist_dir_;
+  bool dist_batch_file_;
+  int dist_batch_cnt_;
   std::string globals_path_;
   bool increaseClipsize_;
   float clipSizeInc_;
@@ -169,6 +177,24 @@ class FlexDR
   void initFromTA();
   void initGCell2BoundaryPin();
   void getBatchInfo(int& batchStepX, int& batchStepY);
+  Rect getWorkerRouteBox(int i, int j, int size) const;
+  // Marks the workers of the size/offset grid that can see a marker,
+  // indexed [x][y]. The others would skip routing, so they aren't built.
+  std::vector<std::vector<bool>> getActiveWorkers(int iter,
+                                                  int size,
+                                                  int offset,
+                                                  int batchStepX,
+                                                  int batchStepY);
+  // Runs the workers of one iteration without checkerboard barriers: a
+  // worker starts once every overlapping neighbor that precedes it in
+  // the checkerboard order has committed. workers is indexed [x][y];
+  // empty slots are workers that were not built. Returns the worker
+  // time summed over all threads in seconds.
+  double runWorkersByDependency(
+      std::vector<std::vector<std::unique_ptr<FlexDRWorker>>>& workers,
+      int batchStepX,
+      int batchStepY,
+      const std::function<void()>& workerDone);
 
   void init_halfViaEncArea();
 
@@ -277,7 +303,8 @@ class FlexDRWorker
         dist_port_(0),
         dist_on_(false),
         isCongested_(false),
-        save_updates_(false)
+        save_updates_(false),
+        design_mutex_(nullptr)
   {
   }
   FlexDRWorker()
@@ -306,7 +333,8 @@ class FlexDRWorker
         dist_port_(0),
         dist_on_(false),
         isCongested_(false),
-        save_updates_(false)
+        save_updates_(false),
+        design_mutex_(nullptr)
   {
   }
   // setters
@@ -319,6 +347,8 @@ class FlexDRWorker
   void setDrcBox(const Rect& boxIn) { drcBox_ = boxIn; }
   void setGCellBox(const Rect& boxIn) { gcellBox_ = boxIn; }
   void setDRIter(int in) { drIter_ = in; }
+  // Set when other workers may commit to the design while this one runs.
+  void setDesignMutex(std::shared_mutex* mutex) { design_mutex_ = mutex; }
   void setDRIter(int in,
                  std::map<frNet*,
                           std::set<std::pair<Point, frLayerNum>>,
@@ -544,6 +574,9 @@ class FlexDRWorker
   bool dist_on_;
   bool isCongested_;
   bool save_updates_;
+  std::shared_mutex* design_mutex_;
+
+  std::shared_lock<std::shared_mutex> readLockDesign() const;
 
   // init
   void init(const frDesign* design);
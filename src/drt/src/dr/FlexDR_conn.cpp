@@ -1151,24 +1151,26 @@ void FlexDRConnectivityChecker::check(int iter)
   omp_set_num_threads(MAX_THREADS);
   for (auto& batch : batches) {
     ProfileTask profile("batch");
+    // Late iterations modify few nets, so size the scratch by the batch.
+    const int numNets = batch.size();
     // prefix a = all batch
     // net->figs
-    vector<NetRouteObjs> aNetRouteObjs(batchSize);
+    vector<NetRouteObjs> aNetRouteObjs(numNets);
     // net->layer->track->indices of RouteObj
     vector<PathSegsByLayerAndTrack> aHorzPathSegs(
-        batchSize, PathSegsByLayerAndTrack(numLayers));
+        numNets, PathSegsByLayerAndTrack(numLayers));
     vector<PathSegsByLayerAndTrack> aVertPathSegs(
-        batchSize, PathSegsByLayerAndTrack(numLayers));
+        numNets, PathSegsByLayerAndTrack(numLayers));
     // net->lnum->trackIdx->objIdxs
     vector<PathSegsByLayerAndTrackId> aHorzVictims(
-        batchSize, PathSegsByLayerAndTrackId(numLayers));
+        numNets, PathSegsByLayerAndTrackId(numLayers));
     vector<PathSegsByLayerAndTrackId> aVertVictims(
-        batchSize, PathSegsByLayerAndTrackId(numLayers));
+        numNets, PathSegsByLayerAndTrackId(numLayers));
     // net->lnum->trackIdx->seg_start_end_pairs
     vector<SpansByLayerAndTrackId> aHorzNewSegSpans(
-        batchSize, SpansByLayerAndTrackId(numLayers));
+        numNets, SpansByLayerAndTrackId(numLayers));
     vector<SpansByLayerAndTrackId> aVertNewSegSpans(
-        batchSize, SpansByLayerAndTrackId(numLayers));
+        numNets, SpansByLayerAndTrackId(numLayers));
 
     ProfileTask init_parallel("init-parallel");
     // parallel
@@ -1224,12 +1226,12 @@ void FlexDRConnectivityChecker::check(int iter)
     }
     // net->term/instTerm->pt_layer
     vector<map<frBlockObject*, set<pair<Point, frLayerNum>>, frBlockObjectComp>>
-        aPin2epMap(batchSize);
-    vector<vector<frBlockObject*>> aNetPins(batchSize);
-    vector<map<pair<Point, frLayerNum>, set<int>>> aNodeMap(batchSize);
-    vector<vector<char>> aAdjVisited(batchSize);
-    vector<vector<int>> aAdjPrevIdx(batchSize);
-    vector<char> status(batchSize, false);
+        aPin2epMap(numNets);
+    vector<vector<frBlockObject*>> aNetPins(numNets);
+    vector<map<pair<Point, frLayerNum>, set<int>>> aNodeMap(numNets);
+    vector<vector<char>> aAdjVisited(numNets);
+    vector<vector<int>> aAdjPrevIdx(numNets);
+    vector<char> status(numNets, false);
 
     merge_serial.done();
     ProfileTask astar_parallel("astar-parallel");
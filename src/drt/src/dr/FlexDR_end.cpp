@@ -27,6 +27,7 @@
  */
 
 #include "dr/FlexDR.h"
+#include "dr/FlexDR_stats.h"
 
 using namespace std;
 using namespace fr;
@@ -611,6 +612,7 @@ bool FlexDRWorker::end(frDesign* design)
   if (skipRouting_ == true) {
     return false;
   }
+  FlexDRStageStats::Timer timer(FlexDRStageStats::END);
   // skip if current clip does not have input DRCs
   // ripupMode = 0 must have enableDRC = true in previous iteration
   if (getDRIter() && getInitNumMarkers() == 0 && !needRecheck_) {
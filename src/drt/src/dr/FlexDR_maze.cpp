@@ -36,6 +36,7 @@
 #include "db/gcObj/gcPin.h"
 #include "dr/FlexDR.h"
 #include "dr/FlexDR_graphics.h"
+#include "dr/FlexDR_stats.h"
 #include "frProfileTask.h"
 #include "gc/FlexGC.h"
 
@@ -2628,6 +2629,8 @@ void FlexDRWorker::checkPathSegStyle(drPathSeg* ps,
 
 bool FlexDRWorker::hasAccessPoint(const Point& pt, frLayerNum lNum, frNet* net)
 {
+  // Other workers may be committing to the design during route_queue.
+  auto design_lock = readLockDesign();
   frRegionQuery::Objects<frBlockObject> result;
   Rect bx(pt.x(), pt.y(), pt.x(), pt.y());
   design_->getRegionQuery()->query(bx, lNum, result);
@@ -2883,13 +2886,18 @@ bool FlexDRWorker::routeNet(drNet* net)
     auto nextPin = routeNet_getNextDst(
         ccMazeIdx1, ccMazeIdx2, mazeIdx2unConnPins, pinTaperBoxes);
     path.clear();
-    if (gridGraph_.search(connComps,
-                          nextPin,
-                          path,
-                          ccMazeIdx1,
-                          ccMazeIdx2,
-                          centerPt,
-                          mazeIdx2TaperBox)) {
+    bool found;
+    {
+      FlexDRStageStats::Timer timer(FlexDRStageStats::MAZE_SEARCH);
+      found = gridGraph_.search(connComps,
+                                nextPin,
+                                path,
+                                ccMazeIdx1,
+                                ccMazeIdx2,
+                                centerPt,
+                                mazeIdx2TaperBox);
+    }
+    if (found) {
       routeNet_postAstarUpdate(
           path, connComps, unConnPins, mazeIdx2unConnPins, isFirstConn);
       routeNet_postAstarWritePath(
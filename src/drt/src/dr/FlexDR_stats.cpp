@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dr/FlexDR_stats.h"
+
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <mutex>
+
+#include "utl/Logger.h"
+
+namespace fr {
+
+namespace {
+
+struct alignas(64) Slot
+{
+  std::array<std::atomic<uint64_t>, FlexDRStageStats::NUM_STAGES> nanos{};
+  std::array<std::atomic<uint64_t>, FlexDRStageStats::NUM_STAGES> calls{};
+};
+
+// Slots are never freed so a collect can still read the counts of a
+// thread that has exited.
+std::mutex slots_mutex;
+std::vector<std::unique_ptr<Slot>> slots;
+
+Slot& getSlot()
+{
+  thread_local Slot* slot = nullptr;
+  if (slot == nullptr) {
+    std::lock_guard<std::mutex> lock(slots_mutex);
+    slots.push_back(std::make_unique<Slot>());
+    slot = slots.back().get();
+  }
+  return *slot;
+}
+
+}  // namespace
+
+void FlexDRStageStats::add(Stage stage, std::chrono::duration<double> elapsed)
+{
+  Slot& slot = getSlot();
+  const auto nanos
+      = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed);
+  slot.nanos[stage].fetch_add(nanos.count(), std::memory_order_relaxed);
+  slot.calls[stage].fetch_add(1, std::memory_order_relaxed);
+}
+
+FlexDRStageStats::Counters FlexDRStageStats::collect()
+{
+  Counters counters;
+  std::lock_guard<std::mutex> lock(slots_mutex);
+  for (auto& slot : slots) {
+    for (int stage = 0; stage < NUM_STAGES; stage++) {
+      const uint64_t nanos
+          = slot->nanos[stage].exchange(0, std::memory_order_relaxed);
+      counters[stage].seconds += nanos * 1e-9;
+      counters[stage].calls
+          += slot->calls[stage].exchange(0, std::memory_order_relaxed);
+    }
+  }
+  return counters;
+}
+
+const char* FlexDRStageStats::getName(Stage stage)
+{
+  switch (stage) {
+    case INIT:
+      return "init";
+    case ROUTE_QUEUE:
+      return "route_queue";
+    case MAZE_SEARCH:
+      return "maze_search";
+    case GC:
+      return "gc";
+    case END:
+      return "end";
+    case NUM_STAGES:
+      break;
+  }
+  return "unknown";
+}
+
+void FlexDRStageStats::report(const Iteration& iteration, utl::Logger* logger)
+{
+  std::string line;
+  for (int stage = 0; stage < NUM_STAGES; stage++) {
+    const Counter& counter = iteration.counters[stage];
+    line += fmt::format(" {} {:.2f}s/{}",
+                        getName(static_cast<Stage>(stage)),
+                        counter.seconds,
+                        counter.calls);
+  }
+  debugPrint(logger,
+             utl::DRT,
+             "stats",
+             1,
+             "Iteration {} stages (thread time/calls):{}.",
+             iteration.iter,
+             line);
+}
+
+bool FlexDRStageStats::writeJSON(const std::string& file_name,
+                                 const std::vector<Iteration>& iterations)
+{
+  std::ofstream out(file_name);
+  if (!out.is_open()) {
+    return false;
+  }
+  out << "{\n  \"iterations\": [";
+  std::string separator = "";
+  for (const Iteration& iteration : iterations) {
+    out << fmt::format(
+        "{}\n    {{\n"
+        "      \"iter\": {},\n"
+        "      \"seconds\": {:.6f},\n"
+        "      \"work_units\": {},\n"
+        "      \"markers\": {},\n"
+        "      \"stages\": {{",
+        separator,
+        iteration.iter,
+        iteration.seconds,
+        iteration.num_work_units,
+        iteration.num_markers);
+    for (int stage = 0; stage < NUM_STAGES; stage++) {
+      const Counter& counter = iteration.counters[stage];
+      out << fmt::format(
+          "{}\n        \"{}\": {{\"seconds\": {:.6f}, \"calls\": {}}}",
+          stage == 0 ? "" : ",",
+          getName(static_cast<Stage>(stage)),
+          counter.seconds,
+          counter.calls);
+    }
+    out << "\n      }\n    }";
+    separator = ",";
+  }
+  out << "\n  ]\n}\n";
+  return out.good();
+}
+
+}  // namespace fr
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace utl {
+class Logger;
+}
+
+namespace fr {
+
+// Always-on timers for the stages of FlexDRWorker.  Each thread adds into
+// its own slot so timing a stage costs two clock reads and two uncontended
+// atomic adds.  FlexDR collects the slots after each iteration, when no
+// worker is running.  ROUTE_QUEUE includes the MAZE_SEARCH and GC time
+// spent inside it.
+class FlexDRStageStats
+{
+ public:
+  enum Stage
+  {
+    INIT,
+    ROUTE_QUEUE,
+    MAZE_SEARCH,
+    GC,
+    END,
+    NUM_STAGES
+  };
+
+  struct Counter
+  {
+    double seconds = 0;
+    uint64_t calls = 0;
+  };
+  using Counters = std::array<Counter, NUM_STAGES>;
+
+  struct Iteration
+  {
+    int iter = 0;
+    double seconds = 0;
+    int num_work_units = 0;
+    int num_markers = 0;
+    Counters counters;
+  };
+
+  // Times its scope (RAII) into the calling thread's slot.
+  class Timer
+  {
+   public:
+    Timer(Stage stage)
+        : stage_(stage), start_(std::chrono::steady_clock::now())
+    {
+    }
+    ~Timer() { add(stage_, std::chrono::steady_clock::now() - start_); }
+
+   private:
+    Stage stage_;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  static void add(Stage stage, std::chrono::duration<double> elapsed);
+  // Sums the counters of all threads and resets them.
+  static Counters collect();
+  static const char* getName(Stage stage);
+
+  static void report(const Iteration& iteration, utl::Logger* logger);
+  static bool writeJSON(const std::string& file_name,
+                        const std::vector<Iteration>& iterations);
+};
+
+}  // namespace fr
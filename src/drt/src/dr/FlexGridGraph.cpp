@@ -71,6 +71,7 @@ void FlexGridGraph::initGrids(
   getDim(xDim, yDim, zDim);
   const int capacity = xDim * yDim * zDim;
 
+  takeFromArena();
   nodes_.clear();
   nodes_.resize(capacity, Node());
   // new
@@ -429,6 +430,47 @@ void FlexGridGraph::initTracks(
   }
 }
 
+FlexGridGraph::Arena& FlexGridGraph::getArena()
+{
+  thread_local Arena arena;
+  return arena;
+}
+
+void FlexGridGraph::takeFromArena()
+{
+  Arena& arena = getArena();
+  nodes_.swap(arena.nodes);
+  prevDirs_.swap(arena.prevDirs);
+  srcs_.swap(arena.srcs);
+  dsts_.swap(arena.dsts);
+  guides_.swap(arena.guides);
+}
+
+template <typename T>
+static void recycle(T& from, T& to)
+{
+  from.clear();
+  if (from.capacity() > to.capacity()) {
+    from.swap(to);
+  }
+  T().swap(from);
+}
+
+void FlexGridGraph::returnToArena()
+{
+  Arena& arena = getArena();
+  recycle(nodes_, arena.nodes);
+  recycle(prevDirs_, arena.prevDirs);
+  recycle(srcs_, arena.srcs);
+  recycle(dsts_, arena.dsts);
+  recycle(guides_, arena.guides);
+}
+
+void FlexGridGraph::releaseArena()
+{
+  getArena() = Arena();
+}
+
 void FlexGridGraph::resetStatus()
 {
   resetSrc();
@@ -848,14 +848,7 @@ class FlexGridGraph
   int nTracksY() { return yCoords_.size(); }
   void cleanup()
   {
-    nodes_.clear();
-    nodes_.shrink_to_fit();
-    srcs_.clear();
-    srcs_.shrink_to_fit();
-    dsts_.clear();
-    dsts_.shrink_to_fit();
-    guides_.clear();
-    guides_.shrink_to_fit();
+    returnToArena();
     xCoords_.clear();
     xCoords_.shrink_to_fit();
     yCoords_.clear();
@@ -869,6 +862,8 @@ class FlexGridGraph
     wavefront_.cleanup();
     wavefront_.fit();
   }
+  // Frees the node storage kept for reuse by graphs on the calling thread.
+  static void releaseArena();
 
   void printNode(frMIdx x, frMIdx y, frMIdx z)
   {
@@ -951,6 +946,20 @@ class FlexGridGraph
 #ifndef DEBUG_DRT_UNDERFLOW
   static_assert(sizeof(Node) == 8);
 #endif
+  // Per-thread node storage handed from one worker's graph to the next.
+  // Workers running on one thread have similar dimensions so reusing the
+  // buffers avoids a fresh allocation (and page faults) per worker.
+  struct Arena
+  {
+    frVector<Node> nodes;
+    std::vector<bool> prevDirs;
+    std::vector<bool> srcs;
+    std::vector<bool> dsts;
+    std::vector<bool> guides;
+  };
+  static Arena& getArena();
+  void takeFromArena();
+  void returnToArena();
   frVector<Node> nodes_;
   std::vector<bool> prevDirs_;
   std::vector<bool> srcs_;
@@ -28,6 +28,7 @@
 
 #include <iostream>
 
+#include "dr/FlexDR_stats.h"
 #include "gc/FlexGC_impl.h"
 
 using namespace std;
@@ -109,6 +110,10 @@ void FlexGCWorker::init(const frDesign* design)
 
 int FlexGCWorker::main()
 {
+  if (impl_->getDRWorker() == nullptr) {
+    return impl_->main();
+  }
+  FlexDRStageStats::Timer timer(FlexDRStageStats::GC);
   return impl_->main();
 }
 
@@ -46,6 +46,7 @@ string DRC_RPT_FILE;
 std::optional<int> DRC_RPT_ITER_STEP;
 string CMAP_FILE;
 string GUIDE_REPORT_FILE;
+string STAGE_STATS_FILE;
 
 // to be removed
 int OR_SEED = -1;
@@ -71,6 +72,8 @@ bool CLEAN_PATCHES = false;
 bool DO_PA = true;
 bool SINGLE_STEP_DR = false;
 bool SAVE_GUIDE_UPDATES = false;
+bool DEPENDENCY_SCHEDULING = false;
+std::string PA_CACHE_FILE;
 
 std::string VIAINPIN_BOTTOMLAYER_NAME;
 std::string VIAINPIN_TOPLAYER_NAME;
@@ -42,6 +42,7 @@ extern std::string DRC_RPT_FILE;
 extern std::optional<int> DRC_RPT_ITER_STEP;
 extern std::string CMAP_FILE;
 extern std::string GUIDE_REPORT_FILE;
+extern std::string STAGE_STATS_FILE;
 // to be removed
 extern int OR_SEED;
 extern double OR_K;
@@ -65,6 +66,8 @@ extern bool CLEAN_PATCHES;
 extern bool DO_PA;
 extern bool SINGLE_STEP_DR;
 extern bool SAVE_GUIDE_UPDATES;
+extern bool DEPENDENCY_SCHEDULING;
+extern std::string PA_CACHE_FILE;
 // extern int TEST;
 extern std::string VIAINPIN_BOTTOMLAYER_NAME;
 extern std::string VIAINPIN_TOPLAYER_NAME;
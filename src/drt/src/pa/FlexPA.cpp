@@ -107,8 +107,10 @@ void FlexPA::applyPatternsFile(const char* file_path)
 void FlexPA::prep()
 {
   ProfileTask profile("PA:prep");
+  loadCache();
   prepPoint();
   revertAccessPoints();
+  updateCache();
   if (isDistributed()) {
     std::vector<paUpdate> updates;
     paUpdate update;
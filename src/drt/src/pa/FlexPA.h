@@ -74,6 +74,9 @@ class FlexPA
                       ushort rport,
                       const std::string& shared_vol,
                       int cloud_sz);
+  // Reuses access points of unique instances saved by an earlier run
+  // in file_path and adds the newly computed ones to it.
+  void setCache(const std::string& file_path, odb::dbDatabase* db);
 
   int main();
 
@@ -110,6 +113,16 @@ class FlexPA
   std::string shared_vol_;
   int cloud_sz_;
 
+  // pin access cache
+  std::string cache_file_;
+  odb::dbDatabase* db_ = nullptr;
+  // cache key -> pin access of each inst term, pin
+  std::map<std::string, std::vector<std::vector<std::unique_ptr<frPinAccess>>>>
+      cache_;
+  // unique instances whose access points come from cache_
+  std::set<frInst*, frBlockObjectComp> cached_insts_;
+  uint64_t cache_hash_ = 0;
+
   // helper functions
   frDesign* getDesign() const { return design_; }
   frTechObject* getTech() const { return design_->getTech(); }
@@ -340,6 +353,12 @@ class FlexPA
                   const std::vector<FlexDPNode>& nodes,
                   const std::vector<frInst*>& insts);
   void revertAccessPoints();
+  // cache
+  void loadCache();
+  void updateCache();
+  void writeCache() const;
+  std::string getCacheKey(frInst* inst);
+  uint64_t getCacheRulesHash() const;
   void addAccessPatternObj(
       frInst* inst,
       FlexPinAccessPattern* accessPattern,
@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+
+#include "FlexPA.h"
+#include "distributed/frArchive.h"
+#include "odb/db.h"
+#include "serialization.h"
+
+using namespace std;
+using namespace fr;
+
+// Bump when the layout of the cache file changes.
+static constexpr int cache_version = 1;
+
+void FlexPA::setCache(const std::string& file_path, odb::dbDatabase* db)
+{
+  cache_file_ = file_path;
+  db_ = db;
+}
+
+// The access points of a unique instance are fully determined by its master,
+// orientation and track offsets once the technology, libraries, tracks and
+// pin access settings are fixed.  Those are folded into one hash that is
+// stored in the cache file; any difference discards the whole cache.
+uint64_t FlexPA::getCacheRulesHash() const
+{
+  char* data = nullptr;
+  size_t size = 0;
+  FILE* stream = open_memstream(&data, &size);
+  db_->writeTech(stream);
+  db_->writeLibs(stream);
+  fclose(stream);
+  std::string rules(data, size);
+  free(data);
+
+  auto out = std::back_inserter(rules);
+  for (const auto& via : getTech()->getVias()) {
+    fmt::format_to(out, "{}\n", via->getName());
+  }
+  for (frTrackPattern* tp : getDesign()->getTopBlock()->getTrackPatterns()) {
+    fmt::format_to(out,
+                   "{} {} {} {} {}\n",
+                   tp->getLayerNum(),
+                   tp->isHorizontal(),
+                   tp->getStartCoord(),
+                   tp->getNumTracks(),
+                   tp->getTrackSpacing());
+  }
+  fmt::format_to(out,
+                 "{} {} {} {} {} {} {} {} {}\n",
+                 DBPROCESSNODE,
+                 BOTTOM_ROUTING_LAYER,
+                 TOP_ROUTING_LAYER,
+                 VIAINPIN_BOTTOMLAYERNUM,
+                 VIAINPIN_TOPLAYERNUM,
+                 MINNUMACCESSPOINT_STDCELLPIN,
+                 MINNUMACCESSPOINT_MACROCELLPIN,
+                 USENONPREFTRACKS,
+                 AUTO_TAPER_NDR_NETS);
+
+  // 64-bit FNV-1a, which unlike std::hash is stable across builds.
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const unsigned char c : rules) {
+    hash ^= c;
+    hash *= 0x100000001b3ULL;
+  }
+  return hash;
+}
+
+std::string FlexPA::getCacheKey(frInst* inst)
+{
+  std::string key = fmt::format(
+      "{} {}", inst->getMaster()->getName(), inst->getOrient().getString());
+  for (const frCoord offset : unique_insts_.getTrackOffsets(inst)) {
+    key += fmt::format(" {}", offset);
+  }
+  // The via checks treat terms on the same net as one owner, so the
+  // connectivity of the terms is part of the key.
+  key += " :";
+  const auto& instTerms = inst->getInstTerms();
+  for (int i = 0; i < (int) instTerms.size(); i++) {
+    frInstTerm* instTerm = instTerms[i].get();
+    if (isSkipInstTerm(instTerm)) {
+      key += " x";
+      continue;
+    }
+    if (!instTerm->hasNet()) {
+      key += " -";
+      continue;
+    }
+    int first = i;
+    for (int j = 0; j < i; j++) {
+      if (instTerms[j]->getNet() == instTerm->getNet()) {
+        first = j;
+        break;
+      }
+    }
+    key += fmt::format(" {}", first);
+  }
+  return key;
+}
+
+void FlexPA::loadCache()
+{
+  cache_.clear();
+  cached_insts_.clear();
+  if (cache_file_.empty()) {
+    return;
+  }
+  cache_hash_ = getCacheRulesHash();
+  std::ifstream file(cache_file_, std::ios::binary);
+  if (!file.is_open()) {
+    return;
+  }
+  try {
+    frIArchive ar(file);
+    ar.setDesign(design_);
+    registerTypes(ar);
+    int version = 0;
+    uint64_t hash = 0;
+    (ar) & version;
+    (ar) & hash;
+    if (version != cache_version || hash != cache_hash_) {
+      logger_->warn(DRT,
+                    618,
+                    "Pin access cache {} was built for a different "
+                    "technology, library or track setup and is ignored.",
+                    cache_file_);
+      return;
+    }
+    int sz = 0;
+    (ar) & sz;
+    while (sz--) {
+      std::string key;
+      (ar) & key;
+      (ar) & cache_[key];
+    }
+  } catch (const std::exception& e) {
+    logger_->warn(DRT,
+                  619,
+                  "Failed to read pin access cache {}: {}.",
+                  cache_file_,
+                  e.what());
+    cache_.clear();
+    return;
+  }
+
+  for (frInst* inst : unique_insts_.getUnique()) {
+    if (unique_insts_.getClass(inst) == nullptr) {
+      // NDR instances are kept out of the cache.
+      continue;
+    }
+    auto it = cache_.find(getCacheKey(inst));
+    if (it == cache_.end()) {
+      continue;
+    }
+    const auto& instTerms = inst->getInstTerms();
+    const auto& entry = it->second;
+    bool match = entry.size() == instTerms.size();
+    for (int i = 0; match && i < (int) instTerms.size(); i++) {
+      match = entry[i].size() == instTerms[i]->getTerm()->getPins().size();
+    }
+    if (match) {
+      cached_insts_.insert(inst);
+    }
+  }
+  logger_->info(DRT,
+                620,
+                "Loaded access points of {} of {} unique instances from {}.",
+                cached_insts_.size(),
+                unique_insts_.getUnique().size(),
+                cache_file_);
+}
+
+// Must run after revertAccessPoints so that cached access points are
+// relative to the instance origin.
+void FlexPA::updateCache()
+{
+  if (cache_file_.empty()) {
+    return;
+  }
+  int numNew = 0;
+  for (frInst* inst : unique_insts_.getUnique()) {
+    if (unique_insts_.getClass(inst) == nullptr) {
+      continue;
+    }
+    const int paIdx = unique_insts_.getPAIndex(inst);
+    const auto& instTerms = inst->getInstTerms();
+    auto& entry = cache_[getCacheKey(inst)];
+    if (cached_insts_.find(inst) != cached_insts_.end()) {
+      for (int i = 0; i < (int) instTerms.size(); i++) {
+        const auto& pins = instTerms[i]->getTerm()->getPins();
+        for (int j = 0; j < (int) pins.size(); j++) {
+          pins[j]->setPinAccess(paIdx,
+                                std::make_unique<frPinAccess>(*entry[i][j]));
+        }
+      }
+      continue;
+    }
+    entry.clear();
+    entry.resize(instTerms.size());
+    for (int i = 0; i < (int) instTerms.size(); i++) {
+      for (auto& pin : instTerms[i]->getTerm()->getPins()) {
+        entry[i].push_back(
+            std::make_unique<frPinAccess>(*pin->getPinAccess(paIdx)));
+      }
+    }
+    numNew++;
+  }
+  if (numNew == 0) {
+    return;
+  }
+  writeCache();
+  logger_->info(DRT,
+                621,
+                "Added access points of {} unique instances to {}.",
+                numNew,
+                cache_file_);
+}
+
+void FlexPA::writeCache() const
+{
+  // Write to the side and rename so that an interrupted run never leaves
+  // a truncated cache behind.
+  const std::string tmp_file = cache_file_ + ".tmp";
+  std::ofstream file(tmp_file, std::ios::binary);
+  if (!file.is_open()) {
+    logger_->warn(
+        DRT, 622, "Unable to write pin access cache {}.", cache_file_);
+    return;
+  }
+  {
+    frOArchive ar(file);
+    registerTypes(ar);
+    int version = cache_version;
+    uint64_t hash = cache_hash_;
+    (ar) & version;
+    (ar) & hash;
+    int sz = cache_.size();
+    (ar) & sz;
+    for (const auto& [key, entry] : cache_) {
+      (ar) & key;
+      (ar) & entry;
+    }
+  }
+  file.close();
+  if (std::rename(tmp_file.c_str(), cache_file_.c_str()) != 0) {
+    logger_->warn(
+        DRT, 623, "Unable to write pin access cache {}.", cache_file_);
+  }
+}
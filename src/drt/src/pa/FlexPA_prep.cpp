@@ -1439,6 +1439,9 @@ void FlexPA::prepPoint()
           && masterType != dbMasterType::RING) {
         continue;
       }
+      if (cached_insts_.find(inst) != cached_insts_.end()) {
+        continue;
+      }
       ProfileTask profile("PA:uniqueInstance");
       for (auto& instTerm : inst->getInstTerms()) {
         // only do for normal and clock terms
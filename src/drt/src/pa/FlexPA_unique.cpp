@@ -180,6 +180,7 @@ void UniqueInsts::computeUnique(
       for (auto& [vec, insts] : offsetMap) {
         auto uniqueInst = *(insts.begin());
         unique_.push_back(uniqueInst);
+        unique2offsets_[uniqueInst] = &vec;
         for (auto i : insts) {
           inst2unique_[i] = uniqueInst;
           inst2Class_[i] = &insts;
@@ -291,6 +292,11 @@ set<frInst*, frBlockObjectComp>* UniqueInsts::getClass(frInst* inst) const
   return inst2Class_.at(inst);
 }
 
+const std::vector<frCoord>& UniqueInsts::getTrackOffsets(frInst* inst) const
+{
+  return *unique2offsets_.at(inst);
+}
+
 bool UniqueInsts::hasUnique(frInst* inst) const
 {
   return inst2unique_.find(inst) != inst2unique_.end();
@@ -59,6 +59,8 @@ class UniqueInsts
 
   // Gets the instances in the equivalence set of the given inst
   set<frInst*, frBlockObjectComp>* getClass(frInst* inst) const;
+  // Gets the track offsets shared by the unique instance's class
+  const std::vector<frCoord>& getTrackOffsets(frInst* inst) const;
 
   const std::vector<frInst*>& getUnique() const;
   frInst* getUnique(int idx) const;
@@ -101,6 +103,9 @@ class UniqueInsts
   std::map<frInst*, int, frBlockObjectComp> unique2paidx_;
   // Maps a unique instance to its index in unique_
   std::map<frInst*, int, frBlockObjectComp> unique2Idx_;
+  // Maps a unique instance to the track offsets of its class
+  std::map<frInst*, const vector<frCoord>*, frBlockObjectComp>
+      unique2offsets_;
   // master orient track-offset to instances
   map<frMaster*,
       map<dbOrientType, map<vector<frCoord>, set<frInst*, frBlockObjectComp>>>,
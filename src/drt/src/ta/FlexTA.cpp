@@ -167,9 +167,11 @@ int FlexTA::initTA_helper(int iter,
     }
   }
 
-  omp_set_num_threads(min(8, MAX_THREADS));
-  // parallel execution
-  // multi thread
+  omp_set_num_threads(MAX_THREADS);
+  // The panels of a batch only see the design as it was before the batch,
+  // so the result does not depend on the thread count.  Each panel's
+  // assignment loop stays serial: every assigned iroute updates the cost
+  // the next one is picked by.
   for (auto& workerBatch : workers) {
     ProfileTask profile("TA:batch");
     ThreadException exception;
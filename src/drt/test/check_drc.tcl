@@ -0,0 +1,45 @@
+# check_drc must report the same violations for any thread count.  The
+# routed ispd18_sample is clean, so its report must match the empty golden
+# check_drc.rptok; with an instance moved onto its neighbour the reports
+# must have violations and still agree.  Each check needs a fresh design,
+# so it is done by a child openroad.
+source "helpers.tcl"
+
+proc run_check_drc { name threads } {
+  set rpt_file [make_result_file check_drc_${name}_$threads.rpt]
+  file delete -force $rpt_file
+  set ::env(DRT_TEST_RPT) $rpt_file
+  if { [catch {exec -ignorestderr [info nameofexecutable] -no_init -exit \
+                 -threads $threads check_drc_run.tcl} output] \
+         || ![file exists $rpt_file] } {
+    puts $output
+    puts "fail: check_drc with $threads threads failed"
+    exit 1
+  }
+  return $rpt_file
+}
+
+foreach threads {1 4} {
+  set rpt_file [run_check_drc clean $threads]
+  if { [diff_files check_drc.rptok $rpt_file] != 0 } {
+    puts "fail: check_drc with $threads threads differs from the golden"
+    exit 1
+  }
+}
+
+set ::env(DRT_TEST_MOVE) 400
+set rpts {}
+foreach threads {1 4} {
+  lappend rpts [run_check_drc moved $threads]
+}
+unset ::env(DRT_TEST_MOVE)
+
+if { [file size [lindex $rpts 0]] == 0 } {
+  puts "fail: check_drc found no violations on a moved instance"
+  exit 1
+}
+if { [diff_files {*}$rpts] != 0 } {
+  puts "fail: check_drc with 1 and 4 threads differs"
+  exit 1
+}
+puts "pass"
@@ -0,0 +1,20 @@
+# Checks the routed ispd18_sample with the thread count given by -threads
+# and writes the report named by DRT_TEST_RPT.  With DRT_TEST_MOVE set, the
+# first placed instance is moved by that many dbu first so that the check
+# has violations to report.  Run by check_drc.tcl.
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def ispd18_sample.defok
+
+if { [info exists ::env(DRT_TEST_MOVE)] } {
+  foreach inst [[ord::get_db_block] getInsts] {
+    if { [$inst getPlacementStatus] == "PLACED" } {
+      lassign [$inst getOrigin] x y
+      $inst setOrigin [expr $x + $::env(DRT_TEST_MOVE)] $y
+      break
+    }
+  }
+}
+
+check_drc -output_file $::env(DRT_TEST_RPT)
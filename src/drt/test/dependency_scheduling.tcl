@@ -0,0 +1,16 @@
+# Routing with workers started by dependency rather than in batches must
+# still finish clean.
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+set_thread_count 4
+detailed_route -dependency_scheduling -verbose 0
+
+set num_drvs [detailed_route_num_drvs]
+if { $num_drvs != 0 } {
+  puts "fail: dependency scheduling left $num_drvs DRC violations"
+  exit 1
+}
+puts "pass"
@@ -0,0 +1,64 @@
+# A pin access cache hit must give the same access points as a cold run,
+# and a settings or technology change must invalidate the cache.
+source "helpers.tcl"
+read_lef "sky130hd/sky130hd.tlef"
+read_lef "sky130hd/sky130hd_std_cell.lef"
+read_def "gcd_sky130hd.def"
+
+set cache [make_result_file pin_access_cache.pa]
+file delete -force $cache
+
+proc write_access_points { file_name } {
+  set stream [open $file_name w]
+  foreach inst [[ord::get_db_block] getInsts] {
+    foreach iterm [$inst getITerms] {
+      foreach ap [$iterm getPrefAccessPoints] {
+        puts $stream "[$inst getName]/[[$iterm getMTerm] getName]\
+          [$ap getPoint] [[$ap getLayer] getName]"
+      }
+    }
+  }
+  close $stream
+}
+
+# The cache is only rewritten when it misses, so its mtime tells a hit
+# from a miss.  Sleep past the mtime resolution between runs.
+proc run_pin_access { args } {
+  global cache
+  after 1100
+  pin_access -pin_access_cache $cache -bottom_routing_layer met1 \
+    -top_routing_layer met5 -verbose 0 {*}$args
+  return [file mtime $cache]
+}
+
+set cold_aps [make_result_file pin_access_cache_cold.aps]
+set warm_aps [make_result_file pin_access_cache_warm.aps]
+
+set mtime [run_pin_access]
+write_access_points $cold_aps
+
+if { [run_pin_access] != $mtime } {
+  puts "fail: cache was rewritten on an unchanged design"
+  exit 1
+}
+write_access_points $warm_aps
+if { [diff_files $cold_aps $warm_aps] != 0 } {
+  puts "fail: cached access points differ from a cold run"
+  exit 1
+}
+
+set new_mtime [run_pin_access -min_access_points 2]
+if { $new_mtime == $mtime } {
+  puts "fail: cache was reused after a settings change"
+  exit 1
+}
+set mtime $new_mtime
+
+set layer [[ord::get_db_tech] findLayer met5]
+$layer setWidth [expr [$layer getWidth] + 10]
+if { [run_pin_access -min_access_points 2] == $mtime } {
+  puts "fail: cache was reused after a technology change"
+  exit 1
+}
+
+puts "pass"
@@ -11,4 +11,9 @@ record_tests {
 }
 record_pass_fail_tests {
   gc_test
+  pin_access_cache
+  ta_threads
+  check_drc
+  dependency_scheduling
+  stage_stats
 }
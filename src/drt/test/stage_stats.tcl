@@ -0,0 +1,62 @@
+# -output_stage_stats must write a JSON report with an entry per routing
+# iteration holding every worker stage.
+source "helpers.tcl"
+package require json
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+
+set stats_file [make_result_file stage_stats.json]
+file delete -force $stats_file
+detailed_route -droute_end_iter 1 -output_stage_stats $stats_file -verbose 0
+
+if { ![file exists $stats_file] } {
+  puts "fail: $stats_file was not written"
+  exit 1
+}
+set stream [open $stats_file r]
+set json_string [read $stream]
+close $stream
+if { [catch {json::json2dict $json_string} stats] } {
+  puts "fail: $stats_file is not valid JSON: $stats"
+  exit 1
+}
+
+set iterations [dict get $stats iterations]
+# Routing stops early once it is clean, so there are one or two.
+if { [llength $iterations] < 1 || [llength $iterations] > 2 } {
+  puts "fail: expected 1 or 2 iterations, found [llength $iterations]"
+  exit 1
+}
+set expected_iter 0
+foreach iteration $iterations {
+  foreach key {iter seconds work_units markers stages} {
+    if { ![dict exists $iteration $key] } {
+      puts "fail: iteration $expected_iter has no $key"
+      exit 1
+    }
+  }
+  if { [dict get $iteration iter] != $expected_iter } {
+    puts "fail: iteration $expected_iter is numbered [dict get $iteration iter]"
+    exit 1
+  }
+  if { [dict get $iteration work_units] <= 0 } {
+    puts "fail: iteration $expected_iter has no work units"
+    exit 1
+  }
+  set stages [dict get $iteration stages]
+  foreach stage {init route_queue maze_search gc end} {
+    if { ![dict exists $stages $stage seconds] \
+           || ![dict exists $stages $stage calls] } {
+      puts "fail: iteration $expected_iter has no $stage stage"
+      exit 1
+    }
+  }
+  if { [dict get $stages init calls] <= 0 } {
+    puts "fail: iteration $expected_iter ran no workers"
+    exit 1
+  }
+  incr expected_iter
+}
+puts "pass"
@@ -0,0 +1,25 @@
+# Track assignment, and with it the routed result, must not depend on the
+# thread count.  Each run needs a fresh design, so it is done by a child
+# openroad.
+source "helpers.tcl"
+
+set defs {}
+foreach threads {1 4} {
+  set def_file [make_result_file ta_threads_$threads.def]
+  file delete -force $def_file
+  set ::env(DRT_TEST_DEF) $def_file
+  if { [catch {exec -ignorestderr [info nameofexecutable] -no_init -exit \
+                 -threads $threads ta_threads_route.tcl} output] \
+         || ![file exists $def_file] } {
+    puts $output
+    puts "fail: routing with $threads threads failed"
+    exit 1
+  }
+  lappend defs $def_file
+}
+
+if { [diff_files {*}$defs] != 0 } {
+  puts "fail: routing with 1 and 4 threads differs"
+  exit 1
+}
+puts "pass"
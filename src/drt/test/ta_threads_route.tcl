@@ -0,0 +1,10 @@
+# Routes ispd18_sample with the thread count given by -threads and writes
+# the DEF named by DRT_TEST_DEF.  Run by ta_threads.tcl.
+source "helpers.tcl"
+
+read_lef testcase/ispd18_sample/ispd18_sample.input.lef
+read_def testcase/ispd18_sample/ispd18_sample.input.def
+read_guides testcase/ispd18_sample/ispd18_sample.input.guide
+detailed_route -droute_end_iter 1 -verbose 0
+
+write_def $::env(DRT_TEST_DEF)
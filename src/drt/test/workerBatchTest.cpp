@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of the University nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE REGENTS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAS_BOOST_UNIT_TEST_LIBRARY
+#define BOOST_TEST_DYN_LINK
+#endif
+#include <unistd.h>
+
+#include <boost/test/unit_test.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "distributed/RoutingJobDescription.h"
+#include "distributed/workerBatch.h"
+
+using namespace fr;
+
+namespace {
+
+using Workers = std::vector<std::pair<int, std::string>>;
+
+std::string batchPath(const std::string& name)
+{
+  return (std::filesystem::temp_directory_path()
+          / ("drt_" + name + "_" + std::to_string(getpid()) + ".bin"))
+      .string();
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(worker_batch);
+
+BOOST_AUTO_TEST_CASE(round_trip)
+{
+  const Workers workers{{3, "abc"}, {7, std::string("d\0e", 3)}, {9, ""}};
+  const std::string path = batchPath("round_trip");
+  RoutingJobDescription desc;
+  BOOST_TEST(writeWorkersFile(path, workers, &desc));
+  BOOST_TEST(desc.hasWorkersFile());
+  BOOST_TEST(desc.getWorkersPath() == path);
+
+  Workers read;
+  BOOST_TEST(readWorkersFile(&desc, read));
+  BOOST_TEST((read == workers));
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(empty_batch)
+{
+  const Workers workers{{1, ""}, {2, ""}};
+  const std::string path = batchPath("empty_batch");
+  RoutingJobDescription desc;
+  BOOST_TEST(writeWorkersFile(path, workers, &desc));
+
+  Workers read;
+  BOOST_TEST(readWorkersFile(&desc, read));
+  BOOST_TEST((read == workers));
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(truncated_file)
+{
+  const std::string path = batchPath("truncated_file");
+  RoutingJobDescription desc;
+  BOOST_TEST(writeWorkersFile(path, {{1, "abcdef"}}, &desc));
+  std::filesystem::resize_file(path, 3);
+
+  Workers read;
+  BOOST_TEST(!readWorkersFile(&desc, read));
+  std::remove(path.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(missing_file)
+{
+  const std::string path = batchPath("missing_file");
+  RoutingJobDescription desc;
+  BOOST_TEST(writeWorkersFile(path, {{1, "abc"}}, &desc));
+  std::remove(path.c_str());
+
+  Workers read;
+  BOOST_TEST(!readWorkersFile(&desc, read));
+}
+
+BOOST_AUTO_TEST_SUITE_END();
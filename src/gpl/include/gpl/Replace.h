@@ -34,11 +34,13 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace odb {
 class dbDatabase;
 class dbInst;
+class Rect;
 }  // namespace odb
 namespace sta {
 class dbSta;
@@ -68,6 +70,7 @@ class TimingBase;
 class InitialPlace;
 class NesterovPlace;
 class Debug;
+class EditRecorder;
 
 class Replace
 {
@@ -82,8 +85,18 @@ class Replace
   void reset();
 
   void doIncrementalPlace();
+  // Windowed incremental placement: only the movable instances whose
+  // center lies in region are placed, the rest of the design is fixed.
+  void doWindowIncrementalPlace(const odb::Rect& region);
+  // Windowed incremental placement around the instances edited since
+  // startEditRecording().  margin < 0 selects ten rows.
+  void doEditIncrementalPlace(int margin);
   void doInitialPlace();
 
+  // Track instance create/move/resize in the block through odb callbacks.
+  void startEditRecording();
+  void stopEditRecording();
+
   int doNesterovPlace(int start_iter = 0);
 
   // Initial Place param settings
@@ -115,6 +128,8 @@ class Replace
   void setPadRight(int padding);
 
   void setForceCPU(bool force_cpu);
+  void setParallelInitialPlace(bool mode);
+  void setNumThreads(int threads);
   void setTimingDrivenMode(bool mode);
 
   void setSkipIoMode(bool mode);
@@ -135,6 +150,11 @@ class Replace
   void addTimingNetWeightOverflow(int overflow);
   void setTimingNetWeightMax(float max);
 
+  // Write <prefix>_<iter>.ckpt every interval Nesterov iterations.
+  void setCheckpoint(const std::string& prefix, int interval);
+  // Resume the next Nesterov placement from a checkpoint file.
+  void setResumeCheckpoint(const std::string& fileName);
+
   void setDebug(int pause_iterations,
                 int update_iterations,
                 bool draw_bins,
@@ -143,6 +163,9 @@ class Replace
 
  private:
   bool initNesterovPlace();
+  int seedUnplacedInsts(const std::vector<odb::dbInst*>& insts,
+                        const odb::Rect& bounds,
+                        bool clamp);
 
   odb::dbDatabase* db_;
   rsz::Resizer* rs_;
@@ -159,12 +182,16 @@ class Replace
   std::unique_ptr<InitialPlace> ip_;
   std::unique_ptr<NesterovPlace> np_;
 
+  std::unique_ptr<EditRecorder> editRecorder_;
+
   int initialPlaceMaxIter_;
   int initialPlaceMinDiffLength_;
   int initialPlaceMaxSolverIter_;
   int initialPlaceMaxFanout_;
   float initialPlaceNetWeightScale_;
   bool forceCPU_;
+  bool parallelInitialPlace_;
+  int num_threads_;
 
   int total_placeable_insts_;
 
@@ -200,6 +227,10 @@ class Replace
 
   std::vector<int> timingNetWeightOverflows_;
 
+  std::string checkpointPrefix_;
+  int checkpointInterval_;
+  std::string resumeCheckpoint_;
+
   // temp variable; OpenDB should have these values.
   int padLeft_;
   int padRight_;
@@ -0,0 +1,130 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+#include <vector>
+
+namespace gpl {
+
+// Raw binary streams used for Nesterov checkpoints.  A checkpoint is only
+// meant to be read back by the same binary on the same design, so values
+// are stored in native layout without any conversion.
+class CheckpointWriter
+{
+ public:
+  explicit CheckpointWriter(std::ostream& os) : os_(os) {}
+
+  template <typename T>
+  void write(const T& value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "checkpoint values must be trivially copyable");
+    os_.write(reinterpret_cast<const char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  void write(const std::vector<T>& values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "checkpoint values must be trivially copyable");
+    write(static_cast<uint64_t>(values.size()));
+    os_.write(reinterpret_cast<const char*>(values.data()),
+              values.size() * sizeof(T));
+  }
+
+  bool ok() const { return os_.good(); }
+
+ private:
+  std::ostream& os_;
+};
+
+class CheckpointReader
+{
+ public:
+  explicit CheckpointReader(std::istream& is) : is_(is) {}
+
+  template <typename T>
+  void read(T& value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "checkpoint values must be trivially copyable");
+    is_.read(reinterpret_cast<char*>(&value), sizeof(T));
+  }
+
+  template <typename T>
+  void read(std::vector<T>& values)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "checkpoint values must be trivially copyable");
+    uint64_t size = 0;
+    read(size);
+    readData(values, size);
+  }
+
+  // Read a vector whose length is known up front; a mismatch marks the
+  // stream as failed instead of allocating a bogus size.
+  template <typename T>
+  void read(std::vector<T>& values, uint64_t expectedSize)
+  {
+    uint64_t size = 0;
+    read(size);
+    if (size != expectedSize) {
+      is_.setstate(std::ios::failbit);
+    }
+    readData(values, size);
+  }
+
+  bool ok() const { return is_.good(); }
+
+ private:
+  template <typename T>
+  void readData(std::vector<T>& values, uint64_t size)
+  {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "checkpoint values must be trivially copyable");
+    if (!is_.good()) {
+      return;
+    }
+    values.resize(size);
+    is_.read(reinterpret_cast<char*>(values.data()), size * sizeof(T));
+  }
+
+  std::istream& is_;
+};
+
+}  // namespace gpl
@@ -0,0 +1,83 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "editRecorder.h"
+
+#include "odb/db.h"
+
+namespace gpl {
+
+void EditRecorder::start(odb::dbBlock* block)
+{
+  clear();
+  block_ = block;
+  addOwner(block);
+}
+
+void EditRecorder::stop()
+{
+  removeOwner();
+}
+
+void EditRecorder::clear()
+{
+  insts_.clear();
+  block_ = nullptr;
+}
+
+void EditRecorder::inDbInstCreate(odb::dbInst* inst)
+{
+  insts_.insert(inst);
+}
+
+void EditRecorder::inDbInstCreate(odb::dbInst* inst, odb::dbRegion* region)
+{
+  insts_.insert(inst);
+}
+
+void EditRecorder::inDbInstDestroy(odb::dbInst* inst)
+{
+  insts_.erase(inst);
+}
+
+void EditRecorder::inDbInstSwapMasterAfter(odb::dbInst* inst)
+{
+  insts_.insert(inst);
+}
+
+void EditRecorder::inDbPostMoveInst(odb::dbInst* inst)
+{
+  insts_.insert(inst);
+}
+
+}  // namespace gpl
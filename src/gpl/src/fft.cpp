@@ -33,10 +33,12 @@
 
 #include "fft.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 
 #define REPLACE_FFT_PI 3.141592653589793238462L
 
@@ -50,7 +52,8 @@ FFT::FFT()
       binCntX_(0),
       binCntY_(0),
       binSizeX_(0),
-      binSizeY_(0)
+      binSizeY_(0),
+      numThreads_(1)
 {
 }
 
@@ -58,7 +61,8 @@ FFT::FFT(int binCntX, int binCntY, int binSizeX, int binSizeY)
     : binCntX_(binCntX),
       binCntY_(binCntY),
       binSizeX_(binSizeX),
-      binSizeY_(binSizeY)
+      binSizeY_(binSizeY),
+      numThreads_(1)
 {
   init();
 }
@@ -114,6 +118,15 @@ void FFT::init()
 
   workArea_.resize(round(sqrt(std::max(binCntX_, binCntY_))) + 2, 0);
 
+  // Build the cos/sin tables up front so that the
+  // 1D transforms only read them from the worker threads.
+  void makewt(int nw, int* ip, float* w);
+  void makect(int nc, int* ip, float* c);
+  const int n = std::max(binCntX_, binCntY_);
+  const int nw = n >> 2;
+  makewt(nw, workArea_.data(), csTable_.data());
+  makect(n, workArea_.data(), csTable_.data() + nw);
+
   for (int i = 0; i < binCntX_; i++) {
     wx_[i]
         = REPLACE_FFT_PI * static_cast<float>(i) / static_cast<float>(binCntX_);
@@ -145,15 +158,14 @@ float FFT::getElectroPhi(int x, int y) const
 
 using namespace std;
 
+void FFT::setNumThreads(int numThreads)
+{
+  numThreads_ = std::max(numThreads, 1);
+}
+
 void FFT::doFFT()
 {
-  ddct2d(binCntX_,
-         binCntY_,
-         -1,
-         binDensity_,
-         NULL,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
+  ddxt2d(-1, false, false, binDensity_);
 
   for (int i = 0; i < binCntX_; i++) {
     binDensity_[i][0] *= 0.5;
@@ -163,12 +175,14 @@ void FFT::doFFT()
     binDensity_[0][i] *= 0.5;
   }
 
+#pragma omp parallel for num_threads(numThreads_)
   for (int i = 0; i < binCntX_; i++) {
     for (int j = 0; j < binCntY_; j++) {
       binDensity_[i][j] *= 4.0 / binCntX_ / binCntY_;
     }
   }
 
+#pragma omp parallel for num_threads(numThreads_)
   for (int i = 0; i < binCntX_; i++) {
     float wx = wx_[i];
     float wx2 = wxSquare_[i];
@@ -205,27 +219,55 @@ void FFT::doFFT()
     }
   }
   // Inverse DCT
-  ddct2d(binCntX_,
-         binCntY_,
-         1,
-         electroPhi_,
-         NULL,
-         (int*) &workArea_[0],
-         (float*) &csTable_[0]);
-  ddsct2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceX_,
-          NULL,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
-  ddcst2d(binCntX_,
-          binCntY_,
-          1,
-          electroForceY_,
-          NULL,
-          (int*) &workArea_[0],
-          (float*) &csTable_[0]);
+  ddxt2d(1, false, false, electroPhi_);
+  // ddsct2d
+  ddxt2d(1, false, true, electroForceX_);
+  // ddcst2d
+  ddxt2d(1, true, false, electroForceY_);
+}
+
+// Same steps as Ooura's ddct2d/ddsct2d/ddcst2d (see fftsg2d.cpp):
+// 1D transforms over every row followed by 1D transforms over every
+// column, four columns at a time through a per-thread buffer.
+// Every row/column is transformed exactly as in the serial code,
+// so the result is identical for any number of threads.
+void FFT::ddxt2d(int isgn, bool rowSine, bool colSine, float** a)
+{
+  const int n1 = binCntX_;
+  const int n2 = binCntY_;
+  int* ip = workArea_.data();
+  float* w = csTable_.data();
+
+#pragma omp parallel for num_threads(numThreads_)
+  for (int i = 0; i < n1; i++) {
+    if (rowSine) {
+      ddst(n2, isgn, a[i], ip, w);
+    } else {
+      ddct(n2, isgn, a[i], ip, w);
+    }
+  }
+
+  const int colGroup = std::min(n2, 4);
+#pragma omp parallel num_threads(numThreads_)
+  {
+    std::vector<float> t(colGroup * n1);
+#pragma omp for
+    for (int j = 0; j < n2; j += colGroup) {
+      for (int k = 0; k < colGroup; k++) {
+        for (int i = 0; i < n1; i++) {
+          t[k * n1 + i] = a[i][j + k];
+        }
+        if (colSine) {
+          ddst(n1, isgn, &t[k * n1], ip, w);
+        } else {
+          ddct(n1, isgn, &t[k * n1], ip, w);
+        }
+        for (int i = 0; i < n1; i++) {
+          a[i][j + k] = t[k * n1 + i];
+        }
+      }
+    }
+  }
 }
 
 }  // namespace gpl
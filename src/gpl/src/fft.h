@@ -50,6 +50,9 @@ class FFT
   // do FFT
   void doFFT();
 
+  // threads used by doFFT; the result does not depend on it.
+  void setNumThreads(int numThreads);
+
   // returning func
   std::pair<float, float> getElectroForce(int x, int y) const;
   float getElectroPhi(int x, int y) const;
@@ -82,8 +85,13 @@ class FFT
   int binCntY_;
   int binSizeX_;
   int binSizeY_;
+  int numThreads_;
 
   void init();
+
+  // 2D DCT/DST: ddct2d, ddsct2d and ddcst2d with
+  // the rows and columns spread over numThreads_.
+  void ddxt2d(int isgn, bool rowSine, bool colSine, float** a);
 };
 
 //
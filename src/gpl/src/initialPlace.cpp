@@ -33,6 +33,7 @@
 
 #include "initialPlace.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "placerBase.h"
@@ -57,6 +58,8 @@ void InitialPlaceVars::reset()
   netWeightScale = 800.0;
   debug = false;
   forceCPU = false;
+  parallelSolver = false;
+  numThreads = 1;
 }
 
 InitialPlace::InitialPlace() : pbc_(nullptr), log_(nullptr)
@@ -123,15 +126,26 @@ void InitialPlace::doBicgstabPlace()
     if (run_cpu) {
       if (ipVars_.forceCPU)
         log_->warn(GPL, 251, "CPU solver is forced to be used.");
-      error = cpuSparseSolve(ipVars_.maxSolverIter,
-                             iter,
-                             placeInstForceMatrixX_,
-                             fixedInstForceVecX_,
-                             instLocVecX_,
-                             placeInstForceMatrixY_,
-                             fixedInstForceVecY_,
-                             instLocVecY_,
-                             log_);
+      if (ipVars_.parallelSolver) {
+        error = cpuParallelSparseSolve(ipVars_.maxSolverIter,
+                                       ipVars_.numThreads,
+                                       placeInstForceMatrixX_,
+                                       fixedInstForceVecX_,
+                                       instLocVecX_,
+                                       placeInstForceMatrixY_,
+                                       fixedInstForceVecY_,
+                                       instLocVecY_);
+      } else {
+        error = cpuSparseSolve(ipVars_.maxSolverIter,
+                               iter,
+                               placeInstForceMatrixX_,
+                               fixedInstForceVecX_,
+                               instLocVecX_,
+                               placeInstForceMatrixY_,
+                               fixedInstForceVecY_,
+                               instLocVecY_,
+                               log_);
+      }
     }
     float error_max = max(error.x, error.y);
     log_->report("[InitialPlace]  Iter: {} CG residual: {:0.8f} HPWL: {}",
@@ -195,14 +209,20 @@ void InitialPlace::setPlaceInstExtId()
 void InitialPlace::updatePinInfo()
 {
   // reset all MinMax attributes
-  for (auto& pin : pbc_->pins()) {
-    pin->unsetMinPinX();
-    pin->unsetMinPinY();
-    pin->unsetMaxPinX();
-    pin->unsetMaxPinY();
+  const auto& pins = pbc_->pins();
+#pragma omp parallel for num_threads(ipVars_.numThreads)
+  for (auto pin = pins.begin(); pin < pins.end(); ++pin) {
+    (*pin)->unsetMinPinX();
+    (*pin)->unsetMinPinY();
+    (*pin)->unsetMaxPinX();
+    (*pin)->unsetMaxPinY();
   }
 
-  for (auto& net : pbc_->nets()) {
+  // every pin belongs to a single net so nets are independent
+  const auto& nets = pbc_->nets();
+#pragma omp parallel for num_threads(ipVars_.numThreads)
+  for (auto it = nets.begin(); it < nets.end(); ++it) {
+    Net* net = *it;
     Pin *pinMinX = nullptr, *pinMinY = nullptr;
     Pin *pinMaxX = nullptr, *pinMaxY = nullptr;
     int lx = INT_MAX, ly = INT_MAX;
@@ -273,8 +293,6 @@ void InitialPlace::createSparseMatrix()
   //
 
   vector<T> listX, listY;
-  listX.reserve(1000000);
-  listY.reserve(1000000);
 
   // initialize vector
   for (auto& inst : pbc_->placeInsts()) {
@@ -286,152 +304,199 @@ void InitialPlace::createSparseMatrix()
     fixedInstForceVecX_(idx) = fixedInstForceVecY_(idx) = 0;
   }
 
-  // for each net
-  for (auto& net : pbc_->nets()) {
-    // skip for small nets.
-    if (net->pins().size() <= 1) {
-      continue;
+  // B2B entries are built per net chunk in parallel.  Merging the chunks
+  // in order keeps the triplet order and the force sums identical to a
+  // serial build.
+  const auto& nets = pbc_->nets();
+  const int netCnt = nets.size();
+  constexpr int netChunkSize = 1024;
+  const int chunkCnt = (netCnt + netChunkSize - 1) / netChunkSize;
+  vector<B2BChunk> chunks(chunkCnt);
+
+#pragma omp parallel for num_threads(ipVars_.numThreads) schedule(dynamic)
+  for (int c = 0; c < chunkCnt; c++) {
+    const int end = std::min(netCnt, (c + 1) * netChunkSize);
+    for (int n = c * netChunkSize; n < end; n++) {
+      addNetB2B(nets[n], chunks[c]);
     }
+  }
 
-    // escape long time cals on huge fanout.
-    //
-    if (net->pins().size() >= ipVars_.maxFanout) {
-      continue;
+  size_t listXSize = 0, listYSize = 0;
+  for (const auto& chunk : chunks) {
+    listXSize += chunk.listX.size();
+    listYSize += chunk.listY.size();
+  }
+  listX.reserve(listXSize);
+  listY.reserve(listYSize);
+
+  for (auto& chunk : chunks) {
+    listX.insert(listX.end(), chunk.listX.begin(), chunk.listX.end());
+    listY.insert(listY.end(), chunk.listY.begin(), chunk.listY.end());
+    for (const auto& [idx, force] : chunk.forceX) {
+      fixedInstForceVecX_(idx) += force;
     }
+    for (const auto& [idx, force] : chunk.forceY) {
+      fixedInstForceVecY_(idx) += force;
+    }
+    chunk = B2BChunk();
+  }
+
+  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
+  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
+}
+
+// B2B model of a single net; appends to chunk instead of the solver
+// arrays so nets can be processed concurrently.
+void InitialPlace::addNetB2B(Net* net, B2BChunk& chunk) const
+{
+  // skip for small nets.
+  if (net->pins().size() <= 1) {
+    return;
+  }
+
+  // escape long time cals on huge fanout.
+  //
+  if (net->pins().size() >= ipVars_.maxFanout) {
+    return;
+  }
 
-    float netWeight = ipVars_.netWeightScale / (net->pins().size() - 1);
-    // cout << "net: " << net.net()->getConstName() << endl;
+  float netWeight = ipVars_.netWeightScale / (net->pins().size() - 1);
+  // cout << "net: " << net.net()->getConstName() << endl;
 
-    // foreach two pins in single nets.
-    auto& pins = net->pins();
-    for (int pinIdx1 = 1; pinIdx1 < pins.size(); ++pinIdx1) {
-      Pin* pin1 = pins[pinIdx1];
-      for (int pinIdx2 = 0; pinIdx2 < pinIdx1; ++pinIdx2) {
-        Pin* pin2 = pins[pinIdx2];
+  // foreach two pins in single nets.
+  auto& pins = net->pins();
+  for (int pinIdx1 = 1; pinIdx1 < pins.size(); ++pinIdx1) {
+    Pin* pin1 = pins[pinIdx1];
+    for (int pinIdx2 = 0; pinIdx2 < pinIdx1; ++pinIdx2) {
+      Pin* pin2 = pins[pinIdx2];
 
-        // no need to fill in when instance is same
-        if (pin1->instance() == pin2->instance()) {
-          continue;
+      // no need to fill in when instance is same
+      if (pin1->instance() == pin2->instance()) {
+        continue;
+      }
+
+      // B2B modeling on min/maxX pins.
+      if (pin1->isMinPinX() || pin1->isMaxPinX() || pin2->isMinPinX()
+          || pin2->isMaxPinX()) {
+        int diffX = abs(pin1->cx() - pin2->cx());
+        float weightX = 0;
+        if (diffX > ipVars_.minDiffLength) {
+          weightX = netWeight / diffX;
+        } else {
+          weightX = netWeight / ipVars_.minDiffLength;
+        }
+
+        // both pin cames from instance
+        if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          const int inst2 = pin2->instance()->extId();
+          // cout << "inst: " << inst1 << " " << inst2 << endl;
+
+          chunk.listX.push_back(T(inst1, inst1, weightX));
+          chunk.listX.push_back(T(inst2, inst2, weightX));
+
+          chunk.listX.push_back(T(inst1, inst2, -weightX));
+          chunk.listX.push_back(T(inst2, inst1, -weightX));
+
+          // cout << pin1->cx() << " "
+          //  << pin1->instance()->cx() << endl;
+          chunk.forceX.emplace_back(
+              inst1,
+              -weightX
+                  * ((pin1->cx() - pin1->instance()->cx())
+                     - (pin2->cx() - pin2->instance()->cx())));
+
+          chunk.forceX.emplace_back(
+              inst2,
+              -weightX
+                  * ((pin2->cx() - pin2->instance()->cx())
+                     - (pin1->cx() - pin1->instance()->cx())));
         }
+        // pin1 from IO port / pin2 from Instance
+        else if (!pin1->isPlaceInstConnected()
+                 && pin2->isPlaceInstConnected()) {
+          const int inst2 = pin2->instance()->extId();
+          // cout << "inst2: " << inst2 << endl;
+          chunk.listX.push_back(T(inst2, inst2, weightX));
+
+          chunk.forceX.emplace_back(
+              inst2,
+              weightX
+                  * (pin1->cx() - (pin2->cx() - pin2->instance()->cx())));
+        }
+        // pin1 from Instance / pin2 from IO port
+        else if (pin1->isPlaceInstConnected()
+                 && !pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          // cout << "inst1: " << inst1 << endl;
+          chunk.listX.push_back(T(inst1, inst1, weightX));
+
+          chunk.forceX.emplace_back(
+              inst1,
+              weightX
+                  * (pin2->cx() - (pin1->cx() - pin1->instance()->cx())));
+        }
+      }
 
-        // B2B modeling on min/maxX pins.
-        if (pin1->isMinPinX() || pin1->isMaxPinX() || pin2->isMinPinX()
-            || pin2->isMaxPinX()) {
-          int diffX = abs(pin1->cx() - pin2->cx());
-          float weightX = 0;
-          if (diffX > ipVars_.minDiffLength) {
-            weightX = netWeight / diffX;
-          } else {
-            weightX = netWeight / ipVars_.minDiffLength;
-          }
-
-          // both pin cames from instance
-          if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            const int inst2 = pin2->instance()->extId();
-            // cout << "inst: " << inst1 << " " << inst2 << endl;
-
-            listX.push_back(T(inst1, inst1, weightX));
-            listX.push_back(T(inst2, inst2, weightX));
-
-            listX.push_back(T(inst1, inst2, -weightX));
-            listX.push_back(T(inst2, inst1, -weightX));
-
-            // cout << pin1->cx() << " "
-            //  << pin1->instance()->cx() << endl;
-            fixedInstForceVecX_(inst1)
-                += -weightX
-                   * ((pin1->cx() - pin1->instance()->cx())
-                      - (pin2->cx() - pin2->instance()->cx()));
-
-            fixedInstForceVecX_(inst2)
-                += -weightX
-                   * ((pin2->cx() - pin2->instance()->cx())
-                      - (pin1->cx() - pin1->instance()->cx()));
-          }
-          // pin1 from IO port / pin2 from Instance
-          else if (!pin1->isPlaceInstConnected()
-                   && pin2->isPlaceInstConnected()) {
-            const int inst2 = pin2->instance()->extId();
-            // cout << "inst2: " << inst2 << endl;
-            listX.push_back(T(inst2, inst2, weightX));
-
-            fixedInstForceVecX_(inst2)
-                += weightX
-                   * (pin1->cx() - (pin2->cx() - pin2->instance()->cx()));
-          }
-          // pin1 from Instance / pin2 from IO port
-          else if (pin1->isPlaceInstConnected()
-                   && !pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            // cout << "inst1: " << inst1 << endl;
-            listX.push_back(T(inst1, inst1, weightX));
-
-            fixedInstForceVecX_(inst1)
-                += weightX
-                   * (pin2->cx() - (pin1->cx() - pin1->instance()->cx()));
-          }
+      // B2B modeling on min/maxY pins.
+      if (pin1->isMinPinY() || pin1->isMaxPinY() || pin2->isMinPinY()
+          || pin2->isMaxPinY()) {
+        int diffY = abs(pin1->cy() - pin2->cy());
+        float weightY = 0;
+        if (diffY > ipVars_.minDiffLength) {
+          weightY = netWeight / diffY;
+        } else {
+          weightY = netWeight / ipVars_.minDiffLength;
         }
 
-        // B2B modeling on min/maxY pins.
-        if (pin1->isMinPinY() || pin1->isMaxPinY() || pin2->isMinPinY()
-            || pin2->isMaxPinY()) {
-          int diffY = abs(pin1->cy() - pin2->cy());
-          float weightY = 0;
-          if (diffY > ipVars_.minDiffLength) {
-            weightY = netWeight / diffY;
-          } else {
-            weightY = netWeight / ipVars_.minDiffLength;
-          }
-
-          // both pin cames from instance
-          if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            const int inst2 = pin2->instance()->extId();
-
-            listY.push_back(T(inst1, inst1, weightY));
-            listY.push_back(T(inst2, inst2, weightY));
-
-            listY.push_back(T(inst1, inst2, -weightY));
-            listY.push_back(T(inst2, inst1, -weightY));
-
-            fixedInstForceVecY_(inst1)
-                += -weightY
-                   * ((pin1->cy() - pin1->instance()->cy())
-                      - (pin2->cy() - pin2->instance()->cy()));
-
-            fixedInstForceVecY_(inst2)
-                += -weightY
-                   * ((pin2->cy() - pin2->instance()->cy())
-                      - (pin1->cy() - pin1->instance()->cy()));
-          }
-          // pin1 from IO port / pin2 from Instance
-          else if (!pin1->isPlaceInstConnected()
-                   && pin2->isPlaceInstConnected()) {
-            const int inst2 = pin2->instance()->extId();
-            listY.push_back(T(inst2, inst2, weightY));
-
-            fixedInstForceVecY_(inst2)
-                += weightY
-                   * (pin1->cy() - (pin2->cy() - pin2->instance()->cy()));
-          }
-          // pin1 from Instance / pin2 from IO port
-          else if (pin1->isPlaceInstConnected()
-                   && !pin2->isPlaceInstConnected()) {
-            const int inst1 = pin1->instance()->extId();
-            listY.push_back(T(inst1, inst1, weightY));
-
-            fixedInstForceVecY_(inst1)
-                += weightY
-                   * (pin2->cy() - (pin1->cy() - pin1->instance()->cy()));
-          }
+        // both pin cames from instance
+        if (pin1->isPlaceInstConnected() && pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          const int inst2 = pin2->instance()->extId();
+
+          chunk.listY.push_back(T(inst1, inst1, weightY));
+          chunk.listY.push_back(T(inst2, inst2, weightY));
+
+          chunk.listY.push_back(T(inst1, inst2, -weightY));
+          chunk.listY.push_back(T(inst2, inst1, -weightY));
+
+          chunk.forceY.emplace_back(
+              inst1,
+              -weightY
+                  * ((pin1->cy() - pin1->instance()->cy())
+                     - (pin2->cy() - pin2->instance()->cy())));
+
+          chunk.forceY.emplace_back(
+              inst2,
+              -weightY
+                  * ((pin2->cy() - pin2->instance()->cy())
+                     - (pin1->cy() - pin1->instance()->cy())));
+        }
+        // pin1 from IO port / pin2 from Instance
+        else if (!pin1->isPlaceInstConnected()
+                 && pin2->isPlaceInstConnected()) {
+          const int inst2 = pin2->instance()->extId();
+          chunk.listY.push_back(T(inst2, inst2, weightY));
+
+          chunk.forceY.emplace_back(
+              inst2,
+              weightY
+                  * (pin1->cy() - (pin2->cy() - pin2->instance()->cy())));
+        }
+        // pin1 from Instance / pin2 from IO port
+        else if (pin1->isPlaceInstConnected()
+                 && !pin2->isPlaceInstConnected()) {
+          const int inst1 = pin1->instance()->extId();
+          chunk.listY.push_back(T(inst1, inst1, weightY));
+
+          chunk.forceY.emplace_back(
+              inst1,
+              weightY
+                  * (pin2->cy() - (pin1->cy() - pin1->instance()->cy())));
         }
       }
     }
   }
-
-  placeInstForceMatrixX_.setFromTriplets(listX.begin(), listX.end());
-  placeInstForceMatrixY_.setFromTriplets(listY.begin(), listY.end());
 }
 
 void InitialPlace::updateCoordi()
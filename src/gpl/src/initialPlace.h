@@ -35,6 +35,8 @@
 
 #include <Eigen/SparseCore>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "nesterovPlace.h"
 #include "odb/db.h"
@@ -48,6 +50,7 @@ namespace gpl {
 class PlacerBaseCommon;
 class PlacerBase;
 class Graphics;
+class Net;
 
 class InitialPlaceVars
 {
@@ -59,6 +62,9 @@ class InitialPlaceVars
   float netWeightScale;
   bool debug;
   bool forceCPU;
+  // use the multithreaded CG solver instead of Eigen's BiCGSTAB
+  bool parallelSolver;
+  int numThreads;
 
   InitialPlaceVars();
   void reset();
@@ -66,6 +72,13 @@ class InitialPlaceVars
 
 typedef Eigen::SparseMatrix<float, Eigen::RowMajor> SMatrix;
 
+// B2B matrix entries and fixed forces of a range of nets
+struct B2BChunk
+{
+  std::vector<Eigen::Triplet<float>> listX, listY;
+  std::vector<std::pair<int, float>> forceX, forceY;
+};
+
 class InitialPlace
 {
  public:
@@ -117,6 +130,7 @@ class InitialPlace
   void setPlaceInstExtId();
   void updatePinInfo();
   void createSparseMatrix();
+  void addNetB2B(Net* net, B2BChunk& chunk) const;
   void updateCoordi();
   void reset();
 };
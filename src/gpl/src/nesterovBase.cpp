@@ -38,11 +38,13 @@
 #include <random>
 #include <utility>
 
+#include "checkpoint.h"
 #include "fft.h"
 #include "nesterovPlace.h"
 #include "odb/db.h"
 #include "placerBase.h"
 #include "utl/Logger.h"
+#include "waKernel.h"
 
 #define REPLACE_SQRT2 1.414213562373095048801L
 
@@ -75,8 +77,6 @@ static float getSecondNorm(const vector<FloatPoint>& a);
 // Choose to use "float" only in the following functions
 static float getOverlapDensityArea(const Bin& bin, const GCell* cell);
 
-static float fastExp(float exp);
-
 ////////////////////////////////////////////////
 // GCell
 
@@ -234,6 +234,30 @@ void GCell::setDensitySize(int dDx, int dDy)
   dUy_ = dCenterY + dDy / 2;
 }
 
+void GCell::setBox(int lx, int ly, int ux, int uy)
+{
+  lx_ = lx;
+  ly_ = ly;
+  ux_ = ux;
+  uy_ = uy;
+
+  for (auto& gPin : gPins_) {
+    gPin->updateLocation(this);
+  }
+}
+
+void GCell::setDensityBox(int dLx, int dLy, int dUx, int dUy)
+{
+  dLx_ = dLx;
+  dLy_ = dLy;
+  dUx_ = dUx;
+  dUy_ = dUy;
+
+  for (auto& gPin : gPins_) {
+    gPin->updateDensityLocation(this);
+  }
+}
+
 void GCell::setDensityScale(float densityScale)
 {
   densityScale_ = densityScale;
@@ -280,24 +304,47 @@ bool GCell::isStdInstance() const
   return !instance()->isMacro();
 }
 
+////////////////////////////////////////////////
+// WireLengthStor
+
+void WireLengthStor::resize(int netCnt, int pinCnt)
+{
+  netPinStart.assign(netCnt + 1, 0);
+
+  for (auto* vec : {&netLx, &netLy, &netUx, &netUy}) {
+    vec->assign(netCnt, 0);
+  }
+
+  for (auto* vec : {&waExpMinSumX,
+                    &waXExpMinSumX,
+                    &waExpMaxSumX,
+                    &waXExpMaxSumX,
+                    &waExpMinSumY,
+                    &waYExpMinSumY,
+                    &waExpMaxSumY,
+                    &waYExpMaxSumY}) {
+    vec->assign(netCnt, 0);
+  }
+
+  pinNet.assign(pinCnt, -1);
+  for (auto* vec : {&pinCx, &pinCy, &pinOffsetCx, &pinOffsetCy}) {
+    vec->assign(pinCnt, 0);
+  }
+
+  for (auto* vec :
+       {&pinMinExpSumX, &pinMaxExpSumX, &pinMinExpSumY, &pinMaxExpSumY}) {
+    vec->assign(pinCnt, 0);
+  }
+}
+
 ////////////////////////////////////////////////
 // GNet
 
 GNet::GNet()
-    : lx_(0),
-      ly_(0),
-      ux_(0),
-      uy_(0),
-      timingWeight_(1),
+    : timingWeight_(1),
       customWeight_(1),
-      waExpMinSumX_(0),
-      waXExpMinSumX_(0),
-      waExpMaxSumX_(0),
-      waXExpMaxSumX_(0),
-      waExpMinSumY_(0),
-      waYExpMinSumY_(0),
-      waExpMaxSumY_(0),
-      waYExpMaxSumY_(0),
+      stor_(nullptr),
+      storIdx_(-1),
       isDontCare_(0)
 {
 }
@@ -323,6 +370,12 @@ Net* GNet::net() const
   return *nets_.begin();
 }
 
+void GNet::setStor(WireLengthStor* stor, int idx)
+{
+  stor_ = stor;
+  storIdx_ = idx;
+}
+
 void GNet::setTimingWeight(float timingWeight)
 {
   timingWeight_ = timingWeight;
@@ -340,42 +393,47 @@ void GNet::addGPin(GPin* gPin)
 
 void GNet::updateBox()
 {
-  lx_ = ly_ = INT_MAX;
-  ux_ = uy_ = INT_MIN;
+  int lx = INT_MAX, ly = INT_MAX;
+  int ux = INT_MIN, uy = INT_MIN;
 
   for (auto& gPin : gPins_) {
-    lx_ = std::min(gPin->cx(), lx_);
-    ly_ = std::min(gPin->cy(), ly_);
-    ux_ = std::max(gPin->cx(), ux_);
-    uy_ = std::max(gPin->cy(), uy_);
+    lx = std::min(gPin->cx(), lx);
+    ly = std::min(gPin->cy(), ly);
+    ux = std::max(gPin->cx(), ux);
+    uy = std::max(gPin->cy(), uy);
   }
+
+  stor_->netLx[storIdx_] = lx;
+  stor_->netLy[storIdx_] = ly;
+  stor_->netUx[storIdx_] = ux;
+  stor_->netUy[storIdx_] = uy;
 }
 
 int64_t GNet::hpwl() const
 {
-  if (ux_ < lx_) {  // dangling net
+  if (ux() < lx()) {  // dangling net
     return 0;
   }
-  int64_t lx = lx_;
-  int64_t ly = ly_;
-  int64_t ux = ux_;
-  int64_t uy = uy_;
+  int64_t lx = this->lx();
+  int64_t ly = this->ly();
+  int64_t ux = this->ux();
+  int64_t uy = this->uy();
   return (ux - lx) + (uy - ly);
 }
 
 void GNet::clearWaVars()
 {
-  waExpMinSumX_ = 0;
-  waXExpMinSumX_ = 0;
+  stor_->waExpMinSumX[storIdx_] = 0;
+  stor_->waXExpMinSumX[storIdx_] = 0;
 
-  waExpMaxSumX_ = 0;
-  waXExpMaxSumX_ = 0;
+  stor_->waExpMaxSumX[storIdx_] = 0;
+  stor_->waXExpMaxSumX[storIdx_] = 0;
 
-  waExpMinSumY_ = 0;
-  waYExpMinSumY_ = 0;
+  stor_->waExpMinSumY[storIdx_] = 0;
+  stor_->waYExpMinSumY[storIdx_] = 0;
 
-  waExpMaxSumY_ = 0;
-  waYExpMaxSumY_ = 0;
+  stor_->waExpMaxSumY[storIdx_] = 0;
+  stor_->waYExpMaxSumY[storIdx_] = 0;
 }
 
 void GNet::setDontCare()
@@ -394,28 +452,22 @@ bool GNet::isDontCare() const
 GPin::GPin()
     : gCell_(nullptr),
       gNet_(nullptr),
-      offsetCx_(0),
-      offsetCy_(0),
-      cx_(0),
-      cy_(0),
-      maxExpSumX_(0),
-      maxExpSumY_(0),
-      minExpSumX_(0),
-      minExpSumY_(0),
-      hasMaxExpSumX_(0),
-      hasMaxExpSumY_(0),
-      hasMinExpSumX_(0),
-      hasMinExpSumY_(0)
+      stor_(nullptr),
+      storIdx_(-1),
+      initCx_(0),
+      initCy_(0),
+      initOffsetCx_(0),
+      initOffsetCy_(0)
 {
 }
 
 GPin::GPin(Pin* pin) : GPin()
 {
   pins_.push_back(pin);
-  cx_ = pin->cx();
-  cy_ = pin->cy();
-  offsetCx_ = pin->offsetCx();
-  offsetCy_ = pin->offsetCy();
+  initCx_ = pin->cx();
+  initCy_ = pin->cy();
+  initOffsetCx_ = pin->offsetCx();
+  initOffsetCy_ = pin->offsetCy();
 }
 
 GPin::GPin(const std::vector<Pin*>& pins) : GPin()
@@ -445,57 +497,59 @@ void GPin::setGNet(GNet* gNet)
   gNet_ = gNet;
 }
 
+void GPin::setStor(WireLengthStor* stor, int idx)
+{
+  stor_ = stor;
+  storIdx_ = idx;
+  stor_->pinCx[idx] = initCx_;
+  stor_->pinCy[idx] = initCy_;
+  stor_->pinOffsetCx[idx] = initOffsetCx_;
+  stor_->pinOffsetCy[idx] = initOffsetCy_;
+  clearWaVars();
+}
+
 void GPin::setCenterLocation(int cx, int cy)
 {
-  cx_ = cx;
-  cy_ = cy;
+  stor_->pinCx[storIdx_] = cx;
+  stor_->pinCy[storIdx_] = cy;
 }
 
 void GPin::clearWaVars()
 {
-  hasMaxExpSumX_ = 0;
-  hasMaxExpSumY_ = 0;
-  hasMinExpSumX_ = 0;
-  hasMinExpSumY_ = 0;
-
-  maxExpSumX_ = maxExpSumY_ = 0;
-  minExpSumX_ = minExpSumY_ = 0;
+  stor_->pinMaxExpSumX[storIdx_] = stor_->pinMaxExpSumY[storIdx_] = 0;
+  stor_->pinMinExpSumX[storIdx_] = stor_->pinMinExpSumY[storIdx_] = 0;
 }
 
 void GPin::setMaxExpSumX(float maxExpSumX)
 {
-  hasMaxExpSumX_ = 1;
-  maxExpSumX_ = maxExpSumX;
+  stor_->pinMaxExpSumX[storIdx_] = maxExpSumX;
 }
 
 void GPin::setMaxExpSumY(float maxExpSumY)
 {
-  hasMaxExpSumY_ = 1;
-  maxExpSumY_ = maxExpSumY;
+  stor_->pinMaxExpSumY[storIdx_] = maxExpSumY;
 }
 
 void GPin::setMinExpSumX(float minExpSumX)
 {
-  hasMinExpSumX_ = 1;
-  minExpSumX_ = minExpSumX;
+  stor_->pinMinExpSumX[storIdx_] = minExpSumX;
 }
 
 void GPin::setMinExpSumY(float minExpSumY)
 {
-  hasMinExpSumY_ = 1;
-  minExpSumY_ = minExpSumY;
+  stor_->pinMinExpSumY[storIdx_] = minExpSumY;
 }
 
 void GPin::updateLocation(const GCell* gCell)
 {
-  cx_ = gCell->cx() + offsetCx_;
-  cy_ = gCell->cy() + offsetCy_;
+  stor_->pinCx[storIdx_] = gCell->cx() + stor_->pinOffsetCx[storIdx_];
+  stor_->pinCy[storIdx_] = gCell->cy() + stor_->pinOffsetCy[storIdx_];
 }
 
 void GPin::updateDensityLocation(const GCell* gCell)
 {
-  cx_ = gCell->dCx() + offsetCx_;
-  cy_ = gCell->dCy() + offsetCy_;
+  stor_->pinCx[storIdx_] = gCell->dCx() + stor_->pinOffsetCx[storIdx_];
+  stor_->pinCy[storIdx_] = gCell->dCy() + stor_->pinOffsetCy[storIdx_];
 }
 
 ////////////////////////////////////////////////////////
@@ -610,6 +664,7 @@ BinGrid::BinGrid()
       targetDensity_(0),
       overflowArea_(0),
       overflowAreaUnscaled_(0),
+      numThreads_(1),
       isSetBinCnt_(0)
 {
 }
@@ -847,70 +902,79 @@ void BinGrid::updateBinsNonPlaceArea()
 void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
 {
   // clear the Bin-area info
-  for (Bin& bin : bins_) {
-    bin.setInstPlacedArea(0);
-    bin.setInstPlacedAreaUnscaled(0);
-    bin.setFillerArea(0);
+#pragma omp parallel for num_threads(numThreads_)
+  for (auto bin = bins_.begin(); bin < bins_.end(); ++bin) {
+    bin->setInstPlacedArea(0);
+    bin->setInstPlacedAreaUnscaled(0);
+    bin->setFillerArea(0);
   }
 
-  for (auto& cell : cells) {
-    std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
-    std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
-
-    // The following function is critical runtime hotspot
-    // for global placer.
+  if (numThreads_ == 1) {
+    for (auto& cell : cells) {
+      addGCellDensityArea(cell);
+    }
+  } else {
+    // Tile-partitioned scatter.
     //
-    if (cell->isInstance()) {
-      // macro should have
-      // scale-down with target-density
-      if (cell->isMacroInstance()) {
-        for (int i = pairX.first; i < pairX.second; i++) {
-          for (int j = pairY.first; j < pairY.second; j++) {
-            Bin& bin = bins_[j * binCntX_ + i];
-
-            const float scaledAvea = getOverlapDensityArea(bin, cell)
-                                     * cell->densityScale()
-                                     * bin.targetDensity();
-            bin.addInstPlacedArea(scaledAvea);
-            bin.addInstPlacedAreaUnscaled(scaledAvea);
-          }
-        }
+    // The bin rows are split into horizontal strips and every cell is
+    // assigned to the strip of its lowest bin row. Cells that reach
+    // at most into the next strip are scattered in two passes
+    // (even strips, then odd strips) so no two threads ever touch the
+    // same bin. The few cells spanning more strips (e.g. macros) are
+    // scattered serially afterwards.
+    //
+    // Bin areas are integers so the result does not depend on the order.
+    const int stripCnt = std::min(binCntY_, numThreads_ * 4);
+    const int stripHeight = (binCntY_ + stripCnt - 1) / stripCnt;
+
+    std::vector<std::vector<const GCell*>> stripCells(stripCnt);
+    std::vector<const GCell*> largeCells;
+    for (const GCell* cell : cells) {
+      std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
+      if (pairY.second <= pairY.first) {
+        continue;
       }
-      // normal cells
-      else if (cell->isStdInstance()) {
-        for (int i = pairX.first; i < pairX.second; i++) {
-          for (int j = pairY.first; j < pairY.second; j++) {
-            Bin& bin = bins_[j * binCntX_ + i];
-            const float scaledArea
-                = getOverlapDensityArea(bin, cell) * cell->densityScale();
-            bin.addInstPlacedArea(scaledArea);
-            bin.addInstPlacedAreaUnscaled(scaledArea);
-          }
-        }
+      const int strip = pairY.first / stripHeight;
+      if ((pairY.second - 1) / stripHeight <= strip + 1) {
+        stripCells[strip].push_back(cell);
+      } else {
+        largeCells.push_back(cell);
       }
-    } else if (cell->isFiller()) {
-      for (int i = pairX.first; i < pairX.second; i++) {
-        for (int j = pairY.first; j < pairY.second; j++) {
-          Bin& bin = bins_[j * binCntX_ + i];
-          bin.addFillerArea(getOverlapDensityArea(bin, cell)
-                            * cell->densityScale());
+    }
+
+    for (int parity = 0; parity < 2; parity++) {
+#pragma omp parallel for num_threads(numThreads_) schedule(dynamic)
+      for (int strip = parity; strip < stripCnt; strip += 2) {
+        for (const GCell* cell : stripCells[strip]) {
+          addGCellDensityArea(cell);
         }
       }
     }
+
+    for (const GCell* cell : largeCells) {
+      addGCellDensityArea(cell);
+    }
+  }
+
+  // update density for nesterov use and FFT library
+#pragma omp parallel for num_threads(numThreads_)
+  for (auto bin = bins_.begin(); bin < bins_.end(); ++bin) {
+    int64_t binArea = bin->binArea();
+    const float scaledBinArea
+        = static_cast<float>(binArea * bin->targetDensity());
+    bin->setDensity((static_cast<float>(bin->instPlacedArea())
+                     + static_cast<float>(bin->fillerArea())
+                     + static_cast<float>(bin->nonPlaceArea()))
+                    / scaledBinArea);
   }
 
+  // overflowArea is summed serially to keep it reproducible
   overflowArea_ = 0;
   overflowAreaUnscaled_ = 0;
-  // update density and overflowArea
-  // for nesterov use and FFT library
   for (Bin& bin : bins_) {
     int64_t binArea = bin.binArea();
     const float scaledBinArea
         = static_cast<float>(binArea * bin.targetDensity());
-    bin.setDensity((static_cast<float>(bin.instPlacedArea())
-                    + static_cast<float>(bin.fillerArea())
-                    + static_cast<float>(bin.nonPlaceArea()))
-                   / scaledBinArea);
 
     overflowArea_ += std::max(0.0f,
                               static_cast<float>(bin.instPlacedArea())
@@ -924,6 +988,53 @@ void BinGrid::updateBinsGCellDensityArea(const std::vector<GCell*>& cells)
   }
 }
 
+void BinGrid::addGCellDensityArea(const GCell* cell)
+{
+  std::pair<int, int> pairX = getDensityMinMaxIdxX(cell);
+  std::pair<int, int> pairY = getDensityMinMaxIdxY(cell);
+
+  // The following function is critical runtime hotspot
+  // for global placer.
+  //
+  if (cell->isInstance()) {
+    // macro should have
+    // scale-down with target-density
+    if (cell->isMacroInstance()) {
+      for (int i = pairX.first; i < pairX.second; i++) {
+        for (int j = pairY.first; j < pairY.second; j++) {
+          Bin& bin = bins_[j * binCntX_ + i];
+
+          const float scaledAvea = getOverlapDensityArea(bin, cell)
+                                   * cell->densityScale()
+                                   * bin.targetDensity();
+          bin.addInstPlacedArea(scaledAvea);
+          bin.addInstPlacedAreaUnscaled(scaledAvea);
+        }
+      }
+    }
+    // normal cells
+    else if (cell->isStdInstance()) {
+      for (int i = pairX.first; i < pairX.second; i++) {
+        for (int j = pairY.first; j < pairY.second; j++) {
+          Bin& bin = bins_[j * binCntX_ + i];
+          const float scaledArea
+              = getOverlapDensityArea(bin, cell) * cell->densityScale();
+          bin.addInstPlacedArea(scaledArea);
+          bin.addInstPlacedAreaUnscaled(scaledArea);
+        }
+      }
+    }
+  } else if (cell->isFiller()) {
+    for (int i = pairX.first; i < pairX.second; i++) {
+      for (int j = pairY.first; j < pairY.second; j++) {
+        Bin& bin = bins_[j * binCntX_ + i];
+        bin.addFillerArea(getOverlapDensityArea(bin, cell)
+                          * cell->densityScale());
+      }
+    }
+  }
+}
+
 std::pair<int, int> BinGrid::getDensityMinMaxIdxX(const GCell* gcell) const
 {
   int lowerIdx = (gcell->dLx() - lx()) / binSizeX_;
@@ -1010,27 +1121,82 @@ void NesterovPlaceVars::reset()
   debug_update_iterations = 10;
   debug_draw_bins = true;
   debug_inst = nullptr;
+  checkpointInterval = 0;
+  checkpointPrefix.clear();
 }
 
 ////////////////////////////////////////////////
 // NesterovBaseCommon
 ///////////////////////////////////////////////
 
-NesterovBaseCommon::NesterovBaseCommon() : pbc_(nullptr), log_(nullptr)
+NesterovBaseCommon::NesterovBaseCommon()
+    : pbc_(nullptr), log_(nullptr), num_threads_(1)
 {
 }
 
 NesterovBaseCommon::NesterovBaseCommon(NesterovBaseVars nbVars,
                                        std::shared_ptr<PlacerBaseCommon> pbc,
-                                       utl::Logger* log)
+                                       utl::Logger* log,
+                                       int num_threads)
     : NesterovBaseCommon()
 {
   nbVars_ = nbVars;
   pbc_ = std::move(pbc);
   log_ = log;
+  setNumThreads(num_threads);
   init();
 }
 
+void NesterovBaseCommon::setNumThreads(int num_threads)
+{
+  num_threads_ = std::max(num_threads, 1);
+}
+
+void NesterovBaseCommon::writeCheckpoint(CheckpointWriter& writer) const
+{
+  std::vector<int> instIds;
+  instIds.reserve(gCells_.size());
+  for (const GCell* gCell : gCells_) {
+    instIds.push_back(gCell->isInstance() ? gCell->instance()->dbInst()->getId()
+                                          : -1);
+  }
+  writer.write(instIds);
+
+  std::vector<float> timingWeights;
+  timingWeights.reserve(gNets_.size());
+  for (const GNet* gNet : gNets_) {
+    timingWeights.push_back(gNet->timingWeight());
+  }
+  writer.write(timingWeights);
+}
+
+bool NesterovBaseCommon::readCheckpoint(CheckpointReader& reader)
+{
+  std::vector<int> instIds;
+  reader.read(instIds, gCells_.size());
+  if (!reader.ok()) {
+    return false;
+  }
+  for (size_t i = 0; i < gCells_.size(); i++) {
+    const GCell* gCell = gCells_[i];
+    const int id
+        = gCell->isInstance() ? gCell->instance()->dbInst()->getId() : -1;
+    if (instIds[i] != id) {
+      return false;
+    }
+  }
+
+  std::vector<float> timingWeights;
+  reader.read(timingWeights, gNets_.size());
+  if (!reader.ok()) {
+    return false;
+  }
+  for (size_t i = 0; i < gNets_.size(); i++) {
+    gNets_[i]->setTimingWeight(timingWeights[i]);
+  }
+  return true;
+}
+
 NesterovBaseCommon::~NesterovBaseCommon()
 {
   reset();
@@ -1054,6 +1220,8 @@ void NesterovBaseCommon::reset()
   gPinMap_.clear();
   gNetMap_.clear();
 
+  wlStor_ = WireLengthStor();
+
   gCellStor_.shrink_to_fit();
   gNetStor_.shrink_to_fit();
   gPinStor_.shrink_to_fit();
@@ -1138,6 +1306,43 @@ void NesterovBaseCommon::init()
       gNet.addGPin(pbToNb(pin));
     }
   }
+
+  initWireLengthStor();
+
+  debugPrint(log_,
+             GPL,
+             "wlUpdateWA",
+             1,
+             "WA kernel: {}",
+             simdLevelName(detectSimdLevel()));
+}
+
+// Lay out the pins net by net (CSR) so the WA kernels
+// stream through contiguous memory.
+void NesterovBaseCommon::initWireLengthStor()
+{
+  wlStor_.resize(gNetStor_.size(), gPinStor_.size());
+
+  int pinIdx = 0;
+  for (size_t netIdx = 0; netIdx < gNetStor_.size(); netIdx++) {
+    GNet& gNet = gNetStor_[netIdx];
+    gNet.setStor(&wlStor_, netIdx);
+    wlStor_.netPinStart[netIdx] = pinIdx;
+    for (GPin* gPin : gNet.gPins()) {
+      gPin->setStor(&wlStor_, pinIdx);
+      wlStor_.pinNet[pinIdx] = netIdx;
+      pinIdx++;
+    }
+    gNet.updateBox();
+  }
+  wlStor_.netPinStart[gNetStor_.size()] = pinIdx;
+
+  // pins without a GNet go after all the nets
+  for (auto& gPin : gPinStor_) {
+    if (gPin.storIdx() == -1) {
+      gPin.setStor(&wlStor_, pinIdx++);
+    }
+  }
 }
 
 GCell* NesterovBaseCommon::pbToNb(Instance* inst) const
@@ -1189,91 +1394,122 @@ GNet* NesterovBaseCommon::dbToNb(odb::dbNet* net) const
 // in ePlace paper.
 void NesterovBaseCommon::updateWireLengthForceWA(float wlCoeffX, float wlCoeffY)
 {
-  // clear all WA variables.
-  for (auto& gNet : gNets_) {
-    gNet->clearWaVars();
-  }
-  for (auto& gPin : gPins_) {
-    gPin->clearWaVars();
-  }
-
-  for (auto& gNet : gNets_) {
-    gNet->updateBox();
+  WireLengthStor& stor = wlStor_;
+  const int netCnt = stor.netCnt();
+  const int netPinCnt = stor.netPinStart[netCnt];
 
-    for (auto& gPin : gNet->gPins()) {
-      // The WA terms are shift invariant:
-      //
-      //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
-      //   -----------------    = -----------------
-      //   Sum(exp(x_i))          Sum(exp(x_i - C))
-      //
-      // So we shift to keep the exponential from overflowing
-      float expMinX = (gNet->lx() - gPin->cx()) * wlCoeffX;
-      float expMaxX = (gPin->cx() - gNet->ux()) * wlCoeffX;
-      float expMinY = (gNet->ly() - gPin->cy()) * wlCoeffY;
-      float expMaxY = (gPin->cy() - gNet->uy()) * wlCoeffY;
-
-      // min x
-      if (expMinX > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumX(fastExp(expMinX));
-        gNet->addWaExpMinSumX(gPin->minExpSumX());
-        gNet->addWaXExpMinSumX(gPin->cx() * gPin->minExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumX());
-        }
-      }
-
-      // max x
-      if (expMaxX > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumX(fastExp(expMaxX));
-        gNet->addWaExpMaxSumX(gPin->maxExpSumX());
-        gNet->addWaXExpMaxSumX(gPin->cx() * gPin->maxExpSumX());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxX updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumX());
-        }
-      }
+  // 1. net bounding boxes and the exponent arguments of every pin.
+  //
+  // The WA terms are shift invariant:
+  //
+  //   Sum(x_i * exp(x_i))    Sum(x_i * exp(x_i - C))
+  //   -----------------    = -----------------
+  //   Sum(exp(x_i))          Sum(exp(x_i - C))
+  //
+  // So we shift to keep the exponential from overflowing.
+  // The arguments are stored in the pin exp arrays and
+  // replaced in place by the next step.
+#pragma omp parallel for num_threads(num_threads_)
+  for (int netIdx = 0; netIdx < netCnt; netIdx++) {
+    const int pinBegin = stor.netPinStart[netIdx];
+    const int pinEnd = stor.netPinStart[netIdx + 1];
+
+    int lx = INT_MAX, ly = INT_MAX;
+    int ux = INT_MIN, uy = INT_MIN;
+    for (int k = pinBegin; k < pinEnd; k++) {
+      lx = std::min(stor.pinCx[k], lx);
+      ly = std::min(stor.pinCy[k], ly);
+      ux = std::max(stor.pinCx[k], ux);
+      uy = std::max(stor.pinCy[k], uy);
+    }
+    stor.netLx[netIdx] = lx;
+    stor.netLy[netIdx] = ly;
+    stor.netUx[netIdx] = ux;
+    stor.netUy[netIdx] = uy;
+
+    for (int k = pinBegin; k < pinEnd; k++) {
+      stor.pinMinExpSumX[k] = (lx - stor.pinCx[k]) * wlCoeffX;
+      stor.pinMaxExpSumX[k] = (stor.pinCx[k] - ux) * wlCoeffX;
+      stor.pinMinExpSumY[k] = (ly - stor.pinCy[k]) * wlCoeffY;
+      stor.pinMaxExpSumY[k] = (stor.pinCy[k] - uy) * wlCoeffY;
+    }
+  }
 
-      // min y
-      if (expMinY > nbVars_.minWireLengthForceBar) {
-        gPin->setMinExpSumY(fastExp(expMinY));
-        gNet->addWaExpMinSumY(gPin->minExpSumY());
-        gNet->addWaYExpMinSumY(gPin->cy() * gPin->minExpSumY());
-        if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MinY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->minExpSumY());
-        }
-      }
+  // 2. batched (SIMD) exponentials over all the pins.
+  // Pins below minWireLengthForceBar are left out of the WA model.
+  const float minForceBar = nbVars_.minWireLengthForceBar;
+  const SimdLevel simdLevel = detectSimdLevel();
+  constexpr int chunkSize = 4096;
+  const int chunkCnt = (netPinCnt + chunkSize - 1) / chunkSize;
+#pragma omp parallel for num_threads(num_threads_)
+  for (int chunk = 0; chunk < chunkCnt; chunk++) {
+    const int begin = chunk * chunkSize;
+    const int count = std::min(chunkSize, netPinCnt - begin);
+    for (float* exps : {stor.pinMinExpSumX.data(),
+                        stor.pinMaxExpSumX.data(),
+                        stor.pinMinExpSumY.data(),
+                        stor.pinMaxExpSumY.data()}) {
+      batchFastExp(exps + begin, exps + begin, count, minForceBar, simdLevel);
+    }
+  }
 
-      // max y
-      if (expMaxY > nbVars_.minWireLengthForceBar) {
-        gPin->setMaxExpSumY(fastExp(expMaxY));
-        gNet->addWaExpMaxSumY(gPin->maxExpSumY());
-        gNet->addWaYExpMaxSumY(gPin->cy() * gPin->maxExpSumY());
+  // 3. per net sums.
+  // Every pin belongs to exactly one net, so the nets can be
+  // processed independently. The pins of a net are always accumulated
+  // in the same order which keeps the sums independent of the thread count.
+  const bool debug = log_->debugCheck(GPL, "wlUpdateWA", 1);
+#pragma omp parallel for num_threads(num_threads_)
+  for (int netIdx = 0; netIdx < netCnt; netIdx++) {
+    const int pinBegin = stor.netPinStart[netIdx];
+    const int pinCnt = stor.netPinStart[netIdx + 1] - pinBegin;
+
+    float waExpMinSumX = 0, waXExpMinSumX = 0;
+    float waExpMaxSumX = 0, waXExpMaxSumX = 0;
+    float waExpMinSumY = 0, waYExpMinSumY = 0;
+    float waExpMaxSumY = 0, waYExpMaxSumY = 0;
+
+    waReduce(&stor.pinMinExpSumX[pinBegin],
+             &stor.pinCx[pinBegin],
+             pinCnt,
+             waExpMinSumX,
+             waXExpMinSumX);
+    waReduce(&stor.pinMaxExpSumX[pinBegin],
+             &stor.pinCx[pinBegin],
+             pinCnt,
+             waExpMaxSumX,
+             waXExpMaxSumX);
+    waReduce(&stor.pinMinExpSumY[pinBegin],
+             &stor.pinCy[pinBegin],
+             pinCnt,
+             waExpMinSumY,
+             waYExpMinSumY);
+    waReduce(&stor.pinMaxExpSumY[pinBegin],
+             &stor.pinCy[pinBegin],
+             pinCnt,
+             waExpMaxSumY,
+             waYExpMaxSumY);
+
+    stor.waExpMinSumX[netIdx] = waExpMinSumX;
+    stor.waXExpMinSumX[netIdx] = waXExpMinSumX;
+    stor.waExpMaxSumX[netIdx] = waExpMaxSumX;
+    stor.waXExpMaxSumX[netIdx] = waXExpMaxSumX;
+    stor.waExpMinSumY[netIdx] = waExpMinSumY;
+    stor.waYExpMinSumY[netIdx] = waYExpMinSumY;
+    stor.waExpMaxSumY[netIdx] = waExpMaxSumY;
+    stor.waYExpMaxSumY[netIdx] = waYExpMaxSumY;
+
+    if (debug) {
+      for (int k = 0; k < pinCnt; k++) {
+        const GPin* gPin = gNetStor_[netIdx].gPins()[k];
         if (gPin->gCell() && gPin->gCell()->isInstance()) {
-          debugPrint(log_,
-                     GPL,
-                     "wlUpdateWA",
-                     1,
-                     "MaxY updated: {} {:g}",
-                     gPin->gCell()->instance()->dbInst()->getConstName(),
-                     gPin->maxExpSumY());
+          log_->debug(GPL,
+                      "wlUpdateWA",
+                      "Updated: {} MinX {:g} MaxX {:g} MinY {:g} MaxY {:g}",
+                      gPin->gCell()->instance()->dbInst()->getConstName(),
+                      gPin->minExpSumX(),
+                      gPin->maxExpSumX(),
+                      gPin->minExpSumY(),
+                      gPin->maxExpSumY());
         }
       }
     }
@@ -1333,49 +1569,55 @@ FloatPoint NesterovBaseCommon::getWireLengthGradientPinWA(const GPin* gPin,
   float gradientMinX = 0, gradientMinY = 0;
   float gradientMaxX = 0, gradientMaxY = 0;
 
+  const WireLengthStor& stor = wlStor_;
+  const int pinIdx = gPin->storIdx();
+  const int netIdx = stor.pinNet[pinIdx];
+  const float cx = stor.pinCx[pinIdx];
+  const float cy = stor.pinCy[pinIdx];
+
   // min x
-  if (gPin->hasMinExpSumX()) {
+  const float minExpSumX = stor.pinMinExpSumX[pinIdx];
+  if (minExpSumX > 0) {
     // from Net.
-    float waExpMinSumX = gPin->gNet()->waExpMinSumX();
-    float waXExpMinSumX = gPin->gNet()->waXExpMinSumX();
+    float waExpMinSumX = stor.waExpMinSumX[netIdx];
+    float waXExpMinSumX = stor.waXExpMinSumX[netIdx];
 
-    gradientMinX
-        = (waExpMinSumX * (gPin->minExpSumX() * (1.0 - wlCoeffX * gPin->cx()))
-           + wlCoeffX * gPin->minExpSumX() * waXExpMinSumX)
-          / (waExpMinSumX * waExpMinSumX);
+    gradientMinX = (waExpMinSumX * (minExpSumX * (1.0 - wlCoeffX * cx))
+                    + wlCoeffX * minExpSumX * waXExpMinSumX)
+                   / (waExpMinSumX * waExpMinSumX);
   }
 
   // max x
-  if (gPin->hasMaxExpSumX()) {
-    float waExpMaxSumX = gPin->gNet()->waExpMaxSumX();
-    float waXExpMaxSumX = gPin->gNet()->waXExpMaxSumX();
+  const float maxExpSumX = stor.pinMaxExpSumX[pinIdx];
+  if (maxExpSumX > 0) {
+    float waExpMaxSumX = stor.waExpMaxSumX[netIdx];
+    float waXExpMaxSumX = stor.waXExpMaxSumX[netIdx];
 
-    gradientMaxX
-        = (waExpMaxSumX * (gPin->maxExpSumX() * (1.0 + wlCoeffX * gPin->cx()))
-           - wlCoeffX * gPin->maxExpSumX() * waXExpMaxSumX)
-          / (waExpMaxSumX * waExpMaxSumX);
+    gradientMaxX = (waExpMaxSumX * (maxExpSumX * (1.0 + wlCoeffX * cx))
+                    - wlCoeffX * maxExpSumX * waXExpMaxSumX)
+                   / (waExpMaxSumX * waExpMaxSumX);
   }
 
   // min y
-  if (gPin->hasMinExpSumY()) {
-    float waExpMinSumY = gPin->gNet()->waExpMinSumY();
-    float waYExpMinSumY = gPin->gNet()->waYExpMinSumY();
+  const float minExpSumY = stor.pinMinExpSumY[pinIdx];
+  if (minExpSumY > 0) {
+    float waExpMinSumY = stor.waExpMinSumY[netIdx];
+    float waYExpMinSumY = stor.waYExpMinSumY[netIdx];
 
-    gradientMinY
-        = (waExpMinSumY * (gPin->minExpSumY() * (1.0 - wlCoeffY * gPin->cy()))
-           + wlCoeffY * gPin->minExpSumY() * waYExpMinSumY)
-          / (waExpMinSumY * waExpMinSumY);
+    gradientMinY = (waExpMinSumY * (minExpSumY * (1.0 - wlCoeffY * cy))
+                    + wlCoeffY * minExpSumY * waYExpMinSumY)
+                   / (waExpMinSumY * waExpMinSumY);
   }
 
   // max y
-  if (gPin->hasMaxExpSumY()) {
-    float waExpMaxSumY = gPin->gNet()->waExpMaxSumY();
-    float waYExpMaxSumY = gPin->gNet()->waYExpMaxSumY();
+  const float maxExpSumY = stor.pinMaxExpSumY[pinIdx];
+  if (maxExpSumY > 0) {
+    float waExpMaxSumY = stor.waExpMaxSumY[netIdx];
+    float waYExpMaxSumY = stor.waYExpMaxSumY[netIdx];
 
-    gradientMaxY
-        = (waExpMaxSumY * (gPin->maxExpSumY() * (1.0 + wlCoeffY * gPin->cy()))
-           - wlCoeffY * gPin->maxExpSumY() * waYExpMaxSumY)
-          / (waExpMaxSumY * waExpMaxSumY);
+    gradientMaxY = (waExpMaxSumY * (maxExpSumY * (1.0 + wlCoeffY * cy))
+                    - wlCoeffY * maxExpSumY * waYExpMaxSumY)
+                   / (waExpMaxSumY * waExpMaxSumY);
   }
 
   debugPrint(log_,
@@ -1416,7 +1658,9 @@ void NesterovBaseCommon::updateDbGCells()
 int64_t NesterovBaseCommon::getHpwl()
 {
   int64_t hpwl = 0;
-  for (auto& gNet : gNets_) {
+#pragma omp parallel for num_threads(num_threads_) reduction(+ : hpwl)
+  for (auto it = gNets_.begin(); it < gNets_.end(); ++it) {
+    GNet* gNet = *it;
     gNet->updateBox();
     hpwl += gNet->hpwl();
   }
@@ -1588,10 +1832,18 @@ void NesterovBase::init()
 
   fft_ = std::move(fft);
 
+  setNumThreads(nbc_->getNumThreads());
+
   // update densitySize and densityScale in each gCell
   updateDensitySize();
 }
 
+void NesterovBase::setNumThreads(int numThreads)
+{
+  bg_.setNumThreads(numThreads);
+  fft_->setNumThreads(numThreads);
+}
+
 // virtual filler GCells
 void NesterovBase::initFillerGCells()
 {
@@ -2024,24 +2276,30 @@ FloatPoint NesterovBase::getDensityGradient(const GCell* gCell) const
 // Density force cals
 void NesterovBase::updateDensityForceBin()
 {
+  std::vector<Bin>& bins = bg_.bins();
+  const int numThreads = nbc_->getNumThreads();
+
   // copy density to utilize FFT
-  for (Bin& bin : bg_.bins()) {
-    fft_->updateDensity(bin.x(), bin.y(), bin.density());
+#pragma omp parallel for num_threads(numThreads)
+  for (auto bin = bins.begin(); bin < bins.end(); ++bin) {
+    fft_->updateDensity(bin->x(), bin->y(), bin->density());
   }
 
   // do FFT
   fft_->doFFT();
 
   // update electroPhi and electroForce
+#pragma omp parallel for num_threads(numThreads)
+  for (auto bin = bins.begin(); bin < bins.end(); ++bin) {
+    auto eForcePair = fft_->getElectroForce(bin->x(), bin->y());
+    bin->setElectroForce(eForcePair.first, eForcePair.second);
+    bin->setElectroPhi(fft_->getElectroPhi(bin->x(), bin->y()));
+  }
+
   // update sumPhi_ for nesterov loop
   sumPhi_ = 0;
-  for (Bin& bin : bg_.bins()) {
-    auto eForcePair = fft_->getElectroForce(bin.x(), bin.y());
-    bin.setElectroForce(eForcePair.first, eForcePair.second);
-
-    float electroPhi = fft_->getElectroPhi(bin.x(), bin.y());
-    bin.setElectroPhi(electroPhi);
-
+  for (Bin& bin : bins) {
+    float electroPhi = bin.electroPhi();
     sumPhi_ += electroPhi
                * static_cast<float>(bin.nonPlaceArea() + bin.instPlacedArea()
                                     + bin.fillerArea());
@@ -2176,24 +2434,15 @@ void NesterovBase::updateGradients(std::vector<FloatPoint>& sumGrads,
   debugPrint(
       log_, GPL, "updateGrad", 1, "DensityPenalty: {:g}", densityPenalty_);
 
+  // Gather the per-cell gradients in parallel; each cell only reads the
+  // net/bin state computed beforehand and writes its own slot.
+#pragma omp parallel for num_threads(nbc_->getNumThreads())
   for (size_t i = 0; i < gCells_.size(); i++) {
-    GCell* gCell = gCells_.at(i);
+    GCell* gCell = gCells_[i];
     wireLengthGrads[i]
         = nbc_->getWireLengthGradientWA(gCell, wlCoeffX, wlCoeffY);
     densityGrads[i] = getDensityGradient(gCell);
 
-    // Different compiler has different results on the following formula.
-    // e.g. wireLengthGradSum_ += fabs(~~.x) + fabs(~~.y);
-    //
-    // To prevent instability problem,
-    // I partitioned the fabs(~~.x) + fabs(~~.y) as two terms.
-    //
-    wireLengthGradSum_ += fabs(wireLengthGrads[i].x);
-    wireLengthGradSum_ += fabs(wireLengthGrads[i].y);
-
-    densityGradSum_ += fabs(densityGrads[i].x);
-    densityGradSum_ += fabs(densityGrads[i].y);
-
     sumGrads[i].x = wireLengthGrads[i].x + densityPenalty_ * densityGrads[i].x;
     sumGrads[i].y = wireLengthGrads[i].y + densityPenalty_ * densityGrads[i].y;
 
@@ -2214,6 +2463,22 @@ void NesterovBase::updateGradients(std::vector<FloatPoint>& sumGrads,
 
     sumGrads[i].x /= sumPrecondi.x;
     sumGrads[i].y /= sumPrecondi.y;
+  }
+
+  // The sums are reduced serially so the result is bit-for-bit identical
+  // regardless of the number of threads.
+  for (size_t i = 0; i < gCells_.size(); i++) {
+    // Different compiler has different results on the following formula.
+    // e.g. wireLengthGradSum_ += fabs(~~.x) + fabs(~~.y);
+    //
+    // To prevent instability problem,
+    // I partitioned the fabs(~~.x) + fabs(~~.y) as two terms.
+    //
+    wireLengthGradSum_ += fabs(wireLengthGrads[i].x);
+    wireLengthGradSum_ += fabs(wireLengthGrads[i].y);
+
+    densityGradSum_ += fabs(densityGrads[i].x);
+    densityGradSum_ += fabs(densityGrads[i].y);
 
     gradSum += fabs(sumGrads[i].x) + fabs(sumGrads[i].y);
   }
@@ -2574,6 +2839,186 @@ bool NesterovBase::revertDivergence()
   return true;
 }
 
+void NesterovBase::writeCheckpoint(CheckpointWriter& writer) const
+{
+  writer.write(static_cast<uint64_t>(gCellInsts_.size()));
+  writer.write(static_cast<uint64_t>(gCellFillers_.size()));
+  writer.write(bg_.binCntX());
+  writer.write(bg_.binCntY());
+
+  std::vector<int> boxes;
+  std::vector<float> densityScales;
+  boxes.reserve(gCells_.size() * 8);
+  densityScales.reserve(gCells_.size());
+  for (const GCell* gCell : gCells_) {
+    boxes.insert(boxes.end(),
+                 {gCell->lx(),
+                  gCell->ly(),
+                  gCell->ux(),
+                  gCell->uy(),
+                  gCell->dLx(),
+                  gCell->dLy(),
+                  gCell->dUx(),
+                  gCell->dUy()});
+    densityScales.push_back(gCell->densityScale());
+  }
+  writer.write(boxes);
+  writer.write(densityScales);
+
+  writer.write(fillerDx_);
+  writer.write(fillerDy_);
+  writer.write(whiteSpaceArea_);
+  writer.write(movableArea_);
+  writer.write(totalFillerArea_);
+  writer.write(stdInstsArea_);
+  writer.write(macroInstsArea_);
+  writer.write(targetDensity_);
+  writer.write(uniformTargetDensity_);
+
+  for (const auto* coordis : {&curSLPCoordi_,
+                              &curSLPWireLengthGrads_,
+                              &curSLPDensityGrads_,
+                              &curSLPSumGrads_,
+                              &nextSLPCoordi_,
+                              &nextSLPWireLengthGrads_,
+                              &nextSLPDensityGrads_,
+                              &nextSLPSumGrads_,
+                              &prevSLPCoordi_,
+                              &prevSLPWireLengthGrads_,
+                              &prevSLPDensityGrads_,
+                              &prevSLPSumGrads_,
+                              &curCoordi_,
+                              &nextCoordi_,
+                              &initCoordi_}) {
+    writer.write(*coordis);
+  }
+  writer.write(densityPenaltyStor_);
+
+  writer.write(wireLengthGradSum_);
+  writer.write(densityGradSum_);
+  writer.write(stepLength_);
+  writer.write(densityPenalty_);
+  writer.write(baseWireLengthCoef_);
+  writer.write(sumOverflow_);
+  writer.write(sumOverflowUnscaled_);
+  writer.write(prevHpwl_);
+  writer.write(isMaxPhiCoefChanged_);
+  writer.write(minSumOverflow);
+  writer.write(hpwlWithMinSumOverflow);
+  writer.write(isConverged_);
+
+  writer.write(isSnapshotSaved);
+  writer.write(snapshotCoordi);
+  writer.write(snapshotSLPCoordi);
+  writer.write(snapshotSLPSumGrads);
+  writer.write(snapshotDensityPenalty);
+  writer.write(snapshotStepLength);
+}
+
+bool NesterovBase::readCheckpoint(CheckpointReader& reader)
+{
+  uint64_t instCnt = 0;
+  uint64_t fillerCnt = 0;
+  int binCntX = 0;
+  int binCntY = 0;
+  reader.read(instCnt);
+  reader.read(fillerCnt);
+  reader.read(binCntX);
+  reader.read(binCntY);
+  // Routability-driven mode may have cut fillers, never added any.
+  if (!reader.ok() || instCnt != gCellInsts_.size()
+      || fillerCnt > gCellFillers_.size() || binCntX != bg_.binCntX()
+      || binCntY != bg_.binCntY()) {
+    return false;
+  }
+  gCellFillers_.resize(fillerCnt);
+  gCells_.resize(instCnt + fillerCnt);
+
+  const size_t cellCnt = gCells_.size();
+  std::vector<int> boxes;
+  std::vector<float> densityScales;
+  reader.read(boxes, cellCnt * 8);
+  reader.read(densityScales, cellCnt);
+  if (!reader.ok()) {
+    return false;
+  }
+  for (size_t i = 0; i < cellCnt; i++) {
+    const int* box = &boxes[i * 8];
+    gCells_[i]->setBox(box[0], box[1], box[2], box[3]);
+    gCells_[i]->setDensityBox(box[4], box[5], box[6], box[7]);
+    gCells_[i]->setDensityScale(densityScales[i]);
+  }
+
+  reader.read(fillerDx_);
+  reader.read(fillerDy_);
+  reader.read(whiteSpaceArea_);
+  reader.read(movableArea_);
+  reader.read(totalFillerArea_);
+  reader.read(stdInstsArea_);
+  reader.read(macroInstsArea_);
+  float targetDensity = 0;
+  reader.read(targetDensity);
+  reader.read(uniformTargetDensity_);
+
+  for (auto* coordis : {&curSLPCoordi_,
+                        &curSLPWireLengthGrads_,
+                        &curSLPDensityGrads_,
+                        &curSLPSumGrads_,
+                        &nextSLPCoordi_,
+                        &nextSLPWireLengthGrads_,
+                        &nextSLPDensityGrads_,
+                        &nextSLPSumGrads_,
+                        &prevSLPCoordi_,
+                        &prevSLPWireLengthGrads_,
+                        &prevSLPDensityGrads_,
+                        &prevSLPSumGrads_,
+                        &curCoordi_,
+                        &nextCoordi_,
+                        &initCoordi_}) {
+    reader.read(*coordis, cellCnt);
+  }
+  reader.read(densityPenaltyStor_);
+
+  reader.read(wireLengthGradSum_);
+  reader.read(densityGradSum_);
+  reader.read(stepLength_);
+  reader.read(densityPenalty_);
+  reader.read(baseWireLengthCoef_);
+  reader.read(sumOverflow_);
+  reader.read(sumOverflowUnscaled_);
+  reader.read(prevHpwl_);
+  reader.read(isMaxPhiCoefChanged_);
+  reader.read(minSumOverflow);
+  reader.read(hpwlWithMinSumOverflow);
+  reader.read(isConverged_);
+
+  reader.read(isSnapshotSaved);
+  reader.read(snapshotCoordi);
+  reader.read(snapshotSLPCoordi);
+  reader.read(snapshotSLPSumGrads);
+  reader.read(snapshotDensityPenalty);
+  reader.read(snapshotStepLength);
+  if (!reader.ok()) {
+    return false;
+  }
+
+  // rebuild the bins and the density field for the restored cells
+  setTargetDensity(targetDensity);
+  bg_.updateBinsGCellDensityArea(gCells_);
+  updateDensityForceBin();
+
+  if (isConverged_) {
+    for (auto& gCell : gCellInsts_) {
+      gCell->instance()->lock();
+    }
+  }
+
+  isDiverged_ = false;
+  divergeCode_ = 0;
+  divergeMsg_ = "";
+  return true;
+}
+
 // https://stackoverflow.com/questions/33333363/built-in-mod-vs-custom-mod-function-improve-the-performance-of-modulus-op
 static int fastModulo(const int input, const int ceil)
 {
@@ -2682,22 +3127,6 @@ static float calculateBiVariateNormalCDF(biNormalParameters i)
 }
 //
 // https://codingforspeed.com/using-faster-exponential-approximation/
-static float fastExp(float a)
-{
-  a = 1.0f + a / 1024.0f;
-  a *= a;
-  a *= a;
-  a *= a;
-  a *= a;
-  a *= a;
-  a *= a;
-  a *= a;
-  a *= a;
-  a *= a;
-  a *= a;
-  return a;
-}
-
 static float getDistance(const vector<FloatPoint>& a,
                          const vector<FloatPoint>& b)
 {
@@ -64,6 +64,8 @@ class Net;
 
 class GPin;
 class FFT;
+class CheckpointReader;
+class CheckpointWriter;
 
 class GCell
 {
@@ -117,6 +119,10 @@ class GCell
   void setDensityCenterLocation(int dCx, int dCy);
   void setDensitySize(int dDx, int dDy);
 
+  // restore the exact geometry, e.g. from a checkpoint
+  void setBox(int lx, int ly, int ux, int uy);
+  void setDensityBox(int dLx, int dLy, int dUx, int dUy);
+
   void setDensityScale(float densityScale);
   void setGradientX(float gradX);
   void setGradientY(float gradY);
@@ -228,6 +234,58 @@ inline int GCell::dDy() const
   return dUy_ - dLy_;
 }
 
+//
+// Structure-of-arrays storage for the net/pin data that the
+// WA (weighted average) wirelength kernels stream through
+// every Nesterov iteration.
+//
+// Pins are grouped by net in CSR form: the pins of net n are
+// stored at [netPinStart[n], netPinStart[n + 1]). Pins that are not
+// connected to any GNet are stored after netPinStart.back().
+//
+// GNet and GPin only keep an index into these arrays and
+// act as views for the graphics/timing/routability code.
+//
+class WireLengthStor
+{
+ public:
+  void resize(int netCnt, int pinCnt);
+  int netCnt() const { return static_cast<int>(netLx.size()); }
+  int pinCnt() const { return static_cast<int>(pinCx.size()); }
+
+  // per net; size is netCnt() + 1
+  std::vector<int> netPinStart;
+
+  // per net bounding box
+  std::vector<int> netLx;
+  std::vector<int> netLy;
+  std::vector<int> netUx;
+  std::vector<int> netUy;
+
+  // per net WA sums. See GNet for the definitions.
+  std::vector<float> waExpMinSumX;
+  std::vector<float> waXExpMinSumX;
+  std::vector<float> waExpMaxSumX;
+  std::vector<float> waXExpMaxSumX;
+  std::vector<float> waExpMinSumY;
+  std::vector<float> waYExpMinSumY;
+  std::vector<float> waExpMaxSumY;
+  std::vector<float> waYExpMaxSumY;
+
+  // per pin, CSR order
+  std::vector<int> pinNet;  // -1 if the pin has no GNet
+  std::vector<int> pinCx;
+  std::vector<int> pinCy;
+  std::vector<int> pinOffsetCx;
+  std::vector<int> pinOffsetCy;
+
+  // per pin WA terms; 0 means the pin is not considered in the WA model.
+  std::vector<float> pinMinExpSumX;
+  std::vector<float> pinMaxExpSumX;
+  std::vector<float> pinMinExpSumY;
+  std::vector<float> pinMaxExpSumY;
+};
+
 class GNet
 {
  public:
@@ -240,6 +298,10 @@ class GNet
   const std::vector<Net*>& nets() const { return nets_; }
   const std::vector<GPin*>& gPins() const { return gPins_; }
 
+  // bind this net to its slot in the SoA storage
+  void setStor(WireLengthStor* stor, int idx);
+  int storIdx() const { return storIdx_; }
+
   int lx() const;
   int ly() const;
   int ux() const;
@@ -289,17 +351,13 @@ class GNet
  private:
   std::vector<GPin*> gPins_;
   std::vector<Net*> nets_;
-  int lx_;
-  int ly_;
-  int ux_;
-  int uy_;
 
   float timingWeight_;
   float customWeight_;
 
   //
-  // weighted average WL model stor for better indexing
-  // Please check the equation (4) in the ePlace-MS paper.
+  // The bounding box and the weighted average WL model sums live in
+  // WireLengthStor; please check the equation (4) in the ePlace-MS paper.
   //
   // WA: weighted Average
   // saving four variable will be helpful for
@@ -309,133 +367,118 @@ class GNet
   //
   // X forces.
   //
-  // waExpMinSumX_: store sigma {exp(x_i/gamma)}
-  // waXExpMinSumX_: store signa {x_i*exp(e_i/gamma)}
-  // waExpMaxSumX_ : store sigma {exp(-x_i/gamma)}
-  // waXExpMaxSumX_: store sigma {x_i*exp(-x_i/gamma)}
-  //
-  float waExpMinSumX_;
-  float waXExpMinSumX_;
-
-  float waExpMaxSumX_;
-  float waXExpMaxSumX_;
-
-  //
-  // Y forces.
+  // waExpMinSumX: store sigma {exp(x_i/gamma)}
+  // waXExpMinSumX: store signa {x_i*exp(e_i/gamma)}
+  // waExpMaxSumX : store sigma {exp(-x_i/gamma)}
+  // waXExpMaxSumX: store sigma {x_i*exp(-x_i/gamma)}
   //
-  // waExpMinSumY_: store sigma {exp(y_i/gamma)}
-  // waYExpMinSumY_: store signa {y_i*exp(e_i/gamma)}
-  // waExpMaxSumY_ : store sigma {exp(-y_i/gamma)}
-  // waYExpMaxSumY_: store sigma {y_i*exp(-y_i/gamma)}
+  // Y forces are stored the same way.
   //
-  float waExpMinSumY_;
-  float waYExpMinSumY_;
-
-  float waExpMaxSumY_;
-  float waYExpMaxSumY_;
+  WireLengthStor* stor_;
+  int storIdx_;
 
   unsigned char isDontCare_ : 1;
 };
 
 inline int GNet::lx() const
 {
-  return lx_;
+  return stor_->netLx[storIdx_];
 }
 
 inline int GNet::ly() const
 {
-  return ly_;
+  return stor_->netLy[storIdx_];
 }
 
 inline int GNet::ux() const
 {
-  return ux_;
+  return stor_->netUx[storIdx_];
 }
 
 inline int GNet::uy() const
 {
-  return uy_;
+  return stor_->netUy[storIdx_];
 }
 
 // eight add functions
 inline void GNet::addWaExpMinSumX(float waExpMinSumX)
 {
-  waExpMinSumX_ += waExpMinSumX;
+  stor_->waExpMinSumX[storIdx_] += waExpMinSumX;
 }
 
 inline void GNet::addWaXExpMinSumX(float waXExpMinSumX)
 {
-  waXExpMinSumX_ += waXExpMinSumX;
+  stor_->waXExpMinSumX[storIdx_] += waXExpMinSumX;
 }
 
 inline void GNet::addWaExpMinSumY(float waExpMinSumY)
 {
-  waExpMinSumY_ += waExpMinSumY;
+  stor_->waExpMinSumY[storIdx_] += waExpMinSumY;
 }
 
 inline void GNet::addWaYExpMinSumY(float waYExpMinSumY)
 {
-  waYExpMinSumY_ += waYExpMinSumY;
+  stor_->waYExpMinSumY[storIdx_] += waYExpMinSumY;
 }
 
 inline void GNet::addWaExpMaxSumX(float waExpMaxSumX)
 {
-  waExpMaxSumX_ += waExpMaxSumX;
+  stor_->waExpMaxSumX[storIdx_] += waExpMaxSumX;
 }
 
 inline void GNet::addWaXExpMaxSumX(float waXExpMaxSumX)
 {
-  waXExpMaxSumX_ += waXExpMaxSumX;
+  stor_->waXExpMaxSumX[storIdx_] += waXExpMaxSumX;
 }
 
 inline void GNet::addWaExpMaxSumY(float waExpMaxSumY)
 {
-  waExpMaxSumY_ += waExpMaxSumY;
+  stor_->waExpMaxSumY[storIdx_] += waExpMaxSumY;
 }
 
 inline void GNet::addWaYExpMaxSumY(float waYExpMaxSumY)
 {
-  waYExpMaxSumY_ += waYExpMaxSumY;
+  stor_->waYExpMaxSumY[storIdx_] += waYExpMaxSumY;
 }
 
 inline float GNet::waExpMinSumX() const
 {
-  return waExpMinSumX_;
+  return stor_->waExpMinSumX[storIdx_];
 }
 
 inline float GNet::waXExpMinSumX() const
 {
-  return waXExpMinSumX_;
+  return stor_->waXExpMinSumX[storIdx_];
 }
 
 inline float GNet::waExpMinSumY() const
 {
-  return waExpMinSumY_;
+  return stor_->waExpMinSumY[storIdx_];
 }
 
 inline float GNet::waYExpMinSumY() const
 {
-  return waYExpMinSumY_;
+  return stor_->waYExpMinSumY[storIdx_];
 }
 
 inline float GNet::waExpMaxSumX() const
 {
-  return waExpMaxSumX_;
+  return stor_->waExpMaxSumX[storIdx_];
 }
 
 inline float GNet::waXExpMaxSumX() const
 {
-  return waXExpMaxSumX_;
+  return stor_->waXExpMaxSumX[storIdx_];
 }
 
 inline float GNet::waExpMaxSumY() const
 {
-  return waExpMaxSumY_;
+  return stor_->waExpMaxSumY[storIdx_];
 }
 
 inline float GNet::waYExpMaxSumY() const
 {
-  return waYExpMaxSumY_;
+  return stor_->waYExpMaxSumY[storIdx_];
 }
 
 class GPin
@@ -455,8 +498,13 @@ class GPin
   void setGCell(GCell* gCell);
   void setGNet(GNet* gNet);
 
-  int cx() const { return cx_; }
-  int cy() const { return cy_; }
+  // bind this pin to its slot in the SoA storage.
+  // The current location and offsets are copied into the storage.
+  void setStor(WireLengthStor* stor, int idx);
+  int storIdx() const { return storIdx_; }
+
+  int cx() const { return stor_->pinCx[storIdx_]; }
+  int cy() const { return stor_->pinCy[storIdx_]; }
 
   // clear WA(Weighted Average) variables.
   void clearWaVars();
@@ -466,15 +514,15 @@ class GPin
   void setMinExpSumX(float minExpSumX);
   void setMinExpSumY(float minExpSumY);
 
-  float maxExpSumX() const { return maxExpSumX_; }
-  float maxExpSumY() const { return maxExpSumY_; }
-  float minExpSumX() const { return minExpSumX_; }
-  float minExpSumY() const { return minExpSumY_; }
+  float maxExpSumX() const { return stor_->pinMaxExpSumX[storIdx_]; }
+  float maxExpSumY() const { return stor_->pinMaxExpSumY[storIdx_]; }
+  float minExpSumX() const { return stor_->pinMinExpSumX[storIdx_]; }
+  float minExpSumY() const { return stor_->pinMinExpSumY[storIdx_]; }
 
-  bool hasMaxExpSumX() const { return (hasMaxExpSumX_ == 1); }
-  bool hasMaxExpSumY() const { return (hasMaxExpSumY_ == 1); }
-  bool hasMinExpSumX() const { return (hasMinExpSumX_ == 1); }
-  bool hasMinExpSumY() const { return (hasMinExpSumY_ == 1); }
+  bool hasMaxExpSumX() const { return maxExpSumX() > 0; }
+  bool hasMaxExpSumY() const { return maxExpSumY() > 0; }
+  bool hasMinExpSumX() const { return minExpSumX() > 0; }
+  bool hasMinExpSumY() const { return minExpSumY() > 0; }
 
   void setCenterLocation(int cx, int cy);
   void updateLocation(const GCell* gCell);
@@ -485,33 +533,23 @@ class GPin
   GNet* gNet_;
   std::vector<Pin*> pins_;
 
-  int offsetCx_;
-  int offsetCy_;
-  int cx_;
-  int cy_;
-
-  // weighted average WL vals stor for better indexing
+  // location, offsets and the weighted average WL vals are
+  // stored in WireLengthStor.
   // Please check the equation (4) in the ePlace-MS paper.
   //
-  // maxExpSum_: holds exp(x_i/gamma)
-  // minExpSum_: holds exp(-x_i/gamma)
-  // the x_i is equal to cx_ variable.
-  //
-  float maxExpSumX_;
-  float maxExpSumY_;
-
-  float minExpSumX_;
-  float minExpSumY_;
-
-  // flag variables
+  // maxExpSum: holds exp(x_i/gamma)
+  // minExpSum: holds exp(-x_i/gamma)
+  // the x_i is equal to cx().
   //
-  // check whether
-  // this pin is considered in a WA models.
-  unsigned char hasMaxExpSumX_ : 1;
-  unsigned char hasMaxExpSumY_ : 1;
-
-  unsigned char hasMinExpSumX_ : 1;
-  unsigned char hasMinExpSumY_ : 1;
+  // A zero value means that this pin is not considered in a WA model.
+  WireLengthStor* stor_;
+  int storIdx_;
+
+  // initial values until the pin is bound to the storage
+  int initCx_;
+  int initCy_;
+  int initOffsetCx_;
+  int initOffsetCy_;
 };
 
 class Bin
@@ -681,6 +719,7 @@ class BinGrid
   void setCorePoints(const Die* die);
   void setBinCnt(int binCntX, int binCntY);
   void setTargetDensity(float density);
+  void setNumThreads(int numThreads) { numThreads_ = numThreads; }
   void updateBinsGCellDensityArea(const std::vector<GCell*>& cells);
 
   void initBins();
@@ -730,8 +769,11 @@ class BinGrid
   float targetDensity_;
   int64_t overflowArea_;
   int64_t overflowAreaUnscaled_;
+  int numThreads_;
 
   unsigned char isSetBinCnt_ : 1;
+
+  void addGCellDensityArea(const GCell* cell);
 };
 
 inline std::vector<Bin>& BinGrid::bins()
@@ -781,6 +823,11 @@ class NesterovPlaceVars
   bool debug_draw_bins;
   odb::dbInst* debug_inst;
 
+  // write <checkpointPrefix>_<iter>.ckpt every checkpointInterval
+  // iterations; 0 disables checkpoints.
+  int checkpointInterval;
+  std::string checkpointPrefix;
+
   NesterovPlaceVars();
   void reset();
 };
@@ -793,7 +840,8 @@ class NesterovBaseCommon
   NesterovBaseCommon();
   NesterovBaseCommon(NesterovBaseVars nbVars,
                      std::shared_ptr<PlacerBaseCommon> pb,
-                     utl::Logger* log);
+                     utl::Logger* log,
+                     int num_threads = 1);
   ~NesterovBaseCommon();
 
   const std::vector<GCell*>& gCells() const { return gCells_; }
@@ -840,15 +888,27 @@ class NesterovBaseCommon
 
   void updateDbGCells();
 
+  // number of OpenMP threads used by the WA / gradient kernels
+  int getNumThreads() const { return num_threads_; }
+  void setNumThreads(int num_threads);
+
+  // instance identity and net weights for Nesterov checkpoints
+  void writeCheckpoint(CheckpointWriter& writer) const;
+  bool readCheckpoint(CheckpointReader& reader);
+
  private:
   NesterovBaseVars nbVars_;
   std::shared_ptr<PlacerBaseCommon> pbc_;
   utl::Logger* log_;
+  int num_threads_;
 
   std::vector<GCell> gCellStor_;
   std::vector<GNet> gNetStor_;
   std::vector<GPin> gPinStor_;
 
+  // SoA storage backing gNetStor_ and gPinStor_
+  WireLengthStor wlStor_;
+
   std::vector<GCell*> gCells_;
   std::vector<GNet*> gNets_;
   std::vector<GPin*> gPins_;
@@ -858,6 +918,7 @@ class NesterovBaseCommon
   std::unordered_map<Net*, GNet*> gNetMap_;
 
   void init();
+  void initWireLengthStor();
   void reset();
 };
 
@@ -967,6 +1028,9 @@ class NesterovBase
 
   BinGrid& getBinGrid() { return bg_; }
 
+  // propagate the thread count to the bin grid and FFT
+  void setNumThreads(int numThreads);
+
   // Nesterov Loop
   void initDensity1();
   float initDensity2(float wlCoeffX, float wlCoeffY);
@@ -1019,6 +1083,11 @@ class NesterovBase
 
   bool isDiverged() const { return isDiverged_; }
 
+  // Nesterov loop state of this region.  readCheckpoint returns false
+  // if the checkpoint does not match this region's gCells.
+  void writeCheckpoint(CheckpointWriter& writer) const;
+  bool readCheckpoint(CheckpointReader& reader);
+
  private:
   NesterovBaseVars nbVars_;
   std::shared_ptr<PlacerBase> pb_;
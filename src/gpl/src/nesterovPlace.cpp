@@ -35,10 +35,12 @@
 
 #include "nesterovPlace.h"
 
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 
+#include "checkpoint.h"
 #include "graphics.h"
 #include "nesterovBase.h"
 #include "odb/db.h"
@@ -68,7 +70,14 @@ NesterovPlace::NesterovPlace()
       isRoutabilityNeed_(true),
       divergeCode_(0),
       recursionCntWlCoef_(0),
-      recursionCntInitSLPCoef_(0)
+      recursionCntInitSLPCoef_(0),
+      curA_(1.0),
+      isSnapshotSaved_(false),
+      snapshotA_(0),
+      snapshotWlCoefX_(0),
+      snapshotWlCoefY_(0),
+      isDivergeTriedRevert_(false),
+      isResumed_(false)
 {
 }
 
@@ -330,35 +339,41 @@ int NesterovPlace::doNesterovPlace(int start_iter)
     graphics_->cellPlot(true);
   }
 
-  // snapshot saving detection
-  bool isSnapshotSaved = false;
+  // A resumed run continues with the loop state of the checkpoint.
+  if (!isResumed_) {
+    // snapshot saving detection
+    isSnapshotSaved_ = false;
 
-  // snapshot info
-  float snapshotA = 0;
-  float snapshotWlCoefX = 0, snapshotWlCoefY = 0;
-  bool isDivergeTriedRevert = false;
+    // snapshot info
+    snapshotA_ = 0;
+    snapshotWlCoefX_ = snapshotWlCoefY_ = 0;
+    isDivergeTriedRevert_ = false;
 
-  // backTracking variable.
-  float curA = 1.0;
+    // backTracking variable.
+    curA_ = 1.0;
+  }
 
   for (auto& nb : nbVec_) {
     nb->setIter(start_iter);
-    nb->setMaxPhiCoefChanged(false);
-    nb->resetMinSumOverflow();
+    if (!isResumed_) {
+      nb->setMaxPhiCoefChanged(false);
+      nb->resetMinSumOverflow();
+    }
   }
+  isResumed_ = false;
 
   // Core Nesterov Loop
   int iter = start_iter;
   for (; iter < npVars_.maxNesterovIter; iter++) {
-    float prevA = curA;
+    float prevA = curA_;
 
     // here, prevA is a_(k), curA is a_(k+1)
     // See, the ePlace-MS paper's Algorithm 1
     //
-    curA = (1.0 + sqrt(4.0 * prevA * prevA + 1.0)) * 0.5;
+    curA_ = (1.0 + sqrt(4.0 * prevA * prevA + 1.0)) * 0.5;
 
     // coeff is (a_k - 1) / ( a_(k+1) ) in paper.
-    float coeff = (prevA - 1.0) / curA;
+    float coeff = (prevA - 1.0) / curA_;
 
     // Back-Tracking loop
     int numBackTrak = 0;
@@ -477,13 +492,13 @@ int NesterovPlace::doNesterovPlace(int start_iter)
 
       // revert back to the original rb solutions
       // one more opportunity
-      if (!isDivergeTriedRevert && rb_->numCall() >= 1) {
+      if (!isDivergeTriedRevert_ && rb_->numCall() >= 1) {
         // get back to the working rc size
         rb_->revertGCellSizeToMinRc();
 
-        curA = snapshotA;
-        wireLengthCoefX_ = snapshotWlCoefX;
-        wireLengthCoefY_ = snapshotWlCoefY;
+        curA_ = snapshotA_;
+        wireLengthCoefX_ = snapshotWlCoefX_;
+        wireLengthCoefY_ = snapshotWlCoefY_;
 
         nbc_->updateWireLengthForceWA(wireLengthCoefX_, wireLengthCoefY_);
 
@@ -494,7 +509,7 @@ int NesterovPlace::doNesterovPlace(int start_iter)
         isDiverged_ = false;
         divergeCode_ = 0;
         divergeMsg_ = "";
-        isDivergeTriedRevert = true;
+        isDivergeTriedRevert_ = true;
         // turn off the RD forcely
         isRoutabilityNeed_ = false;
       } else {
@@ -503,12 +518,12 @@ int NesterovPlace::doNesterovPlace(int start_iter)
       }
     }
 
-    if (!isSnapshotSaved && npVars_.routabilityDrivenMode
+    if (!isSnapshotSaved_ && npVars_.routabilityDrivenMode
         && 0.6 >= average_overflow_unscaled_) {
-      snapshotWlCoefX = wireLengthCoefX_;
-      snapshotWlCoefY = wireLengthCoefY_;
-      snapshotA = curA;
-      isSnapshotSaved = true;
+      snapshotWlCoefX_ = wireLengthCoefX_;
+      snapshotWlCoefY_ = wireLengthCoefY_;
+      snapshotA_ = curA_;
+      isSnapshotSaved_ = true;
 
       for (auto& nb : nbVec_) {
         nb->snapshot();
@@ -531,9 +546,9 @@ int NesterovPlace::doNesterovPlace(int start_iter)
         // cutFillerCoordinates();
 
         // revert back the current density penality
-        curA = snapshotA;
-        wireLengthCoefX_ = snapshotWlCoefX;
-        wireLengthCoefY_ = snapshotWlCoefY;
+        curA_ = snapshotA_;
+        wireLengthCoefX_ = snapshotWlCoefX_;
+        wireLengthCoefY_ = snapshotWlCoefY_;
 
         nbc_->updateWireLengthForceWA(wireLengthCoefX_, wireLengthCoefY_);
 
@@ -555,6 +570,13 @@ int NesterovPlace::doNesterovPlace(int start_iter)
       // log_->report("[NesterovSolve] Finished, all regions converged");
       break;
     }
+
+    if (npVars_.checkpointInterval > 0
+        && (iter + 1) % npVars_.checkpointInterval == 0) {
+      writeCheckpoint(
+          fmt::format("{}_{}.ckpt", npVars_.checkpointPrefix, iter + 1),
+          iter + 1);
+    }
   }
   // in all case including diverge,
   // db should be updated.
@@ -611,4 +633,138 @@ void NesterovPlace::updateDb()
   nbc_->updateDbGCells();
 }
 
+// "GPLCKPT" + format version
+static constexpr uint64_t checkpointMagic = 0x47504c434b505401;
+
+void NesterovPlace::writeCheckpoint(const std::string& fileName,
+                                    int startIter) const
+{
+  std::ofstream os(fileName, std::ios::binary | std::ios::trunc);
+  if (!os) {
+    log_->error(GPL, 160, "Cannot open checkpoint file {}.", fileName);
+  }
+  CheckpointWriter writer(os);
+
+  writer.write(checkpointMagic);
+  writer.write(static_cast<uint64_t>(nbVec_.size()));
+  writer.write(startIter);
+
+  writer.write(baseWireLengthCoef_);
+  writer.write(wireLengthCoefX_);
+  writer.write(wireLengthCoefY_);
+  writer.write(prevHpwl_);
+  writer.write(total_sum_overflow_);
+  writer.write(total_sum_overflow_unscaled_);
+  writer.write(average_overflow_);
+  writer.write(average_overflow_unscaled_);
+  writer.write(densityPenaltyStor_);
+  writer.write(isRoutabilityNeed_);
+  writer.write(recursionCntWlCoef_);
+  writer.write(recursionCntInitSLPCoef_);
+  writer.write(npVars_.timingDrivenMode);
+  writer.write(npVars_.initialPrevCoordiUpdateCoef);
+
+  writer.write(curA_);
+  writer.write(isSnapshotSaved_);
+  writer.write(snapshotA_);
+  writer.write(snapshotWlCoefX_);
+  writer.write(snapshotWlCoefY_);
+  writer.write(isDivergeTriedRevert_);
+
+  nbc_->writeCheckpoint(writer);
+  for (const auto& nb : nbVec_) {
+    nb->writeCheckpoint(writer);
+  }
+  rb_->writeCheckpoint(writer);
+  tb_->writeCheckpoint(writer);
+
+  os.flush();
+  if (!writer.ok()) {
+    log_->error(GPL, 161, "Failed to write checkpoint file {}.", fileName);
+  }
+  log_->info(GPL, 162, "Wrote checkpoint {} at iter {}.", fileName, startIter);
+}
+
+int NesterovPlace::readCheckpoint(const std::string& fileName)
+{
+  std::ifstream is(fileName, std::ios::binary);
+  if (!is) {
+    log_->error(GPL, 163, "Cannot open checkpoint file {}.", fileName);
+  }
+  CheckpointReader reader(is);
+
+  uint64_t magic = 0;
+  uint64_t regionCnt = 0;
+  int startIter = 0;
+  reader.read(magic);
+  reader.read(regionCnt);
+  reader.read(startIter);
+  if (!reader.ok() || magic != checkpointMagic) {
+    log_->error(
+        GPL, 164, "{} is not a global placement checkpoint.", fileName);
+  }
+  if (regionCnt != nbVec_.size()) {
+    log_->error(GPL,
+                165,
+                "Checkpoint {} has {} regions but the design has {}.",
+                fileName,
+                regionCnt,
+                nbVec_.size());
+  }
+
+  bool timingDrivenMode = false;
+  reader.read(baseWireLengthCoef_);
+  reader.read(wireLengthCoefX_);
+  reader.read(wireLengthCoefY_);
+  reader.read(prevHpwl_);
+  reader.read(total_sum_overflow_);
+  reader.read(total_sum_overflow_unscaled_);
+  reader.read(average_overflow_);
+  reader.read(average_overflow_unscaled_);
+  reader.read(densityPenaltyStor_);
+  reader.read(isRoutabilityNeed_);
+  reader.read(recursionCntWlCoef_);
+  reader.read(recursionCntInitSLPCoef_);
+  reader.read(timingDrivenMode);
+  reader.read(npVars_.initialPrevCoordiUpdateCoef);
+
+  reader.read(curA_);
+  reader.read(isSnapshotSaved_);
+  reader.read(snapshotA_);
+  reader.read(snapshotWlCoefX_);
+  reader.read(snapshotWlCoefY_);
+  reader.read(isDivergeTriedRevert_);
+
+  // timing-driven mode can only have been switched off by the earlier run
+  npVars_.timingDrivenMode = npVars_.timingDrivenMode && timingDrivenMode;
+
+  bool matches = reader.ok() && nbc_->readCheckpoint(reader);
+  for (auto& nb : nbVec_) {
+    matches = matches && nb->readCheckpoint(reader);
+  }
+  if (!matches) {
+    log_->error(GPL,
+                166,
+                "Checkpoint {} does not match the current design.",
+                fileName);
+  }
+  rb_->readCheckpoint(reader);
+  tb_->readCheckpoint(reader);
+  if (!reader.ok()) {
+    log_->error(
+        GPL, 167, "Checkpoint {} is truncated or corrupt.", fileName);
+  }
+
+  nbc_->updateWireLengthForceWA(wireLengthCoefX_, wireLengthCoefY_);
+
+  isDiverged_ = false;
+  divergeCode_ = 0;
+  divergeMsg_ = "";
+  isResumed_ = true;
+
+  log_->info(
+      GPL, 168, "Resuming from checkpoint {} at iter {}.", fileName, startIter);
+  return startIter;
+}
+
 }  // namespace gpl
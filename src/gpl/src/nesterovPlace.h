@@ -90,6 +90,12 @@ class NesterovPlace
   void updateCurGradient(const std::shared_ptr<NesterovBase>& nb);
   void updateNextGradient(const std::shared_ptr<NesterovBase>& nb);
 
+  // Save the whole Nesterov state so a later run can resume at startIter.
+  void writeCheckpoint(const std::string& fileName, int startIter) const;
+  // Restore a checkpoint written for the same design; returns the
+  // iteration to pass to doNesterovPlace.
+  int readCheckpoint(const std::string& fileName);
+
  private:
   std::shared_ptr<PlacerBaseCommon> pbc_;
   std::shared_ptr<NesterovBaseCommon> nbc_;
@@ -128,6 +134,17 @@ class NesterovPlace
   int recursionCntWlCoef_;
   int recursionCntInitSLPCoef_;
 
+  // Nesterov loop state; kept in members so it can be checkpointed.
+  // See the ePlace-MS paper's Algorithm 1 for a_k (curA_).
+  float curA_;
+  bool isSnapshotSaved_;
+  float snapshotA_;
+  float snapshotWlCoefX_;
+  float snapshotWlCoefY_;
+  bool isDivergeTriedRevert_;
+  // set by readCheckpoint so doNesterovPlace keeps the loop state
+  bool isResumed_;
+
   void cutFillerCoordinates();
 
   void init();
@@ -73,7 +73,8 @@ Instance::Instance()
       uy_(0),
       extId_(INT_MIN),
       is_macro_(false),
-      is_locked_(false)
+      is_locked_(false),
+      is_frozen_(false)
 {
 }
 
@@ -137,6 +138,11 @@ bool Instance::isFixed() const
     return true;
   }
 
+  // frozen instance is fixed for the incremental window run
+  if (is_frozen_) {
+    return true;
+  }
+
   switch (inst_->getPlacementStatus()) {
     case dbPlacementStatus::NONE:
     case dbPlacementStatus::UNPLACED:
@@ -778,6 +784,9 @@ void PlacerBaseVars::reset()
 {
   padLeft = padRight = 0;
   skipIoMode = false;
+  useWindow = false;
+  window = odb::Rect();
+  windowInsts.clear();
 }
 
 ////////////////////////////////////////////////////////
@@ -844,6 +853,33 @@ void PlacerBaseCommon::init()
   log_->info(GPL, 4, "CoreAreaLxLy: {} {}", die_.coreLx(), die_.coreLy());
   log_->info(GPL, 5, "CoreAreaUxUy: {} {}", die_.coreUx(), die_.coreUy());
 
+  if (pbVars_.useWindow) {
+    // Snap the window outwards onto the site grid so the unusable-site
+    // handling of each PlacerBase stays aligned with the rows.
+    odb::Rect& window = pbVars_.window;
+    auto snapDown = [](int v, int origin, int step) {
+      return origin + ((v - origin) / step) * step;
+    };
+    auto snapUp = [](int v, int origin, int step) {
+      return origin + ((v - origin + step - 1) / step) * step;
+    };
+    window.init(
+        snapDown(window.xMin(), coreRect.xMin(), siteSizeX_),
+        snapDown(window.yMin(), coreRect.yMin(), siteSizeY_),
+        std::min(snapUp(window.xMax(), coreRect.xMin(), siteSizeX_),
+                 coreRect.xMax()),
+        std::min(snapUp(window.yMax(), coreRect.yMin(), siteSizeY_),
+                 coreRect.yMax()));
+    log_->info(GPL,
+               152,
+               "IncrementalWindow: ({} {}) ({} {}) with {} free instances",
+               window.xMin(),
+               window.yMin(),
+               window.xMax(),
+               window.yMax(),
+               pbVars_.windowInsts.size());
+  }
+
   // insts fill with real instances
   dbSet<dbInst> insts = block->getInsts();
   instStor_.reserve(insts.size());
@@ -853,11 +889,19 @@ void PlacerBaseCommon::init()
     if (!type.isCore() && !type.isBlock()) {
       continue;
     }
+    // Outside the incremental window everything stays where it is.
+    const bool frozen
+        = pbVars_.useWindow
+          && pbVars_.windowInsts.find(inst) == pbVars_.windowInsts.end();
+
     Instance myInst(inst,
-                    pbVars_.padLeft * siteSizeX_,
-                    pbVars_.padRight * siteSizeX_,
+                    frozen ? 0 : pbVars_.padLeft * siteSizeX_,
+                    frozen ? 0 : pbVars_.padRight * siteSizeX_,
                     siteSizeY_,
                     log_);
+    if (frozen) {
+      myInst.freeze();
+    }
 
     // Fixed instaces need to be snapped outwards to the nearest site
     // boundary.  A partially overlapped site is unusable and this
@@ -1068,6 +1112,9 @@ void PlacerBase::init()
   slog_ = log_;
 
   die_ = pbCommon_->die();
+  if (pbCommon_->useWindow()) {
+    die_.setCoreBox(pbCommon_->window());
+  }
 
   // siteSize update
   siteSizeX_ = pbCommon_->siteSizeX();
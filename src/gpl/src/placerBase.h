@@ -35,8 +35,11 @@
 
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+#include "odb/geom.h"
+
 namespace odb {
 class dbDatabase;
 
@@ -97,6 +100,11 @@ class Instance
   void lock();
   void unlock();
 
+  // A placeable instance outside the incremental placement window.
+  // It is treated as fixed for the whole run.
+  bool isFrozen() const { return is_frozen_; }
+  void freeze() { is_frozen_ = true; }
+
   // Dummy is virtual instance to fill in
   // unusable sites.  It will have inst_ as nullptr
   bool isDummy() const;
@@ -137,6 +145,7 @@ class Instance
   int extId_;
   bool is_macro_;
   bool is_locked_;
+  bool is_frozen_;
 };
 
 class Pin
@@ -298,6 +307,12 @@ class PlacerBaseVars
   int padRight;
   bool skipIoMode;
 
+  // Windowed incremental placement: only windowInsts are placeable and
+  // every PlacerBase has its core area clipped to window.
+  bool useWindow;
+  odb::Rect window;
+  std::unordered_set<odb::dbInst*> windowInsts;
+
   PlacerBaseVars();
   void reset();
 };
@@ -332,6 +347,9 @@ class PlacerBaseCommon
   int padLeft() const { return pbVars_.padLeft; }
   int padRight() const { return pbVars_.padRight; }
 
+  bool useWindow() const { return pbVars_.useWindow; }
+  const odb::Rect& window() const { return pbVars_.window; }
+
   int64_t hpwl() const;
   void printInfo() const;
 
@@ -35,6 +35,7 @@
 
 #include <iostream>
 
+#include "editRecorder.h"
 #include "initialPlace.h"
 #include "nesterovBase.h"
 #include "nesterovPlace.h"
@@ -50,6 +51,26 @@ namespace gpl {
 using namespace std;
 using utl::GPL;
 
+namespace {
+
+// Overrides a placement mode for the current scope; the previous value is
+// restored even if placement errors out.
+class ScopedModeOverride
+{
+ public:
+  ScopedModeOverride(bool& mode, bool value) : mode_(mode), saved_(mode)
+  {
+    mode_ = value;
+  }
+  ~ScopedModeOverride() { mode_ = saved_; }
+
+ private:
+  bool& mode_;
+  const bool saved_;
+};
+
+}  // namespace
+
 Replace::Replace()
     : db_(nullptr),
       rs_(nullptr),
@@ -61,12 +82,15 @@ Replace::Replace()
       tb_(nullptr),
       ip_(nullptr),
       np_(nullptr),
+      editRecorder_(std::make_unique<EditRecorder>()),
       initialPlaceMaxIter_(20),
       initialPlaceMinDiffLength_(1500),
       initialPlaceMaxSolverIter_(100),
       initialPlaceMaxFanout_(200),
       initialPlaceNetWeightScale_(800),
       forceCPU_(false),
+      parallelInitialPlace_(false),
+      num_threads_(1),
       nesterovPlaceMaxIter_(5000),
       binGridCntX_(0),
       binGridCntY_(0),
@@ -93,6 +117,7 @@ Replace::Replace()
       routabilityDrivenMode_(true),
       uniformTargetDensityMode_(false),
       skipIoMode_(false),
+      checkpointInterval_(0),
       padLeft_(0),
       padRight_(0),
       gui_debug_(false),
@@ -139,6 +164,7 @@ void Replace::reset()
   initialPlaceMaxFanout_ = 200;
   initialPlaceNetWeightScale_ = 800;
   forceCPU_ = false;
+  parallelInitialPlace_ = false;
 
   nesterovPlaceMaxIter_ = 5000;
   binGridCntX_ = binGridCntY_ = 0;
@@ -171,6 +197,10 @@ void Replace::reset()
   timingNetWeightOverflows_.shrink_to_fit();
   timingNetWeightMax_ = 1.9;
 
+  checkpointPrefix_.clear();
+  checkpointInterval_ = 0;
+  resumeCheckpoint_.clear();
+
   gui_debug_ = false;
   gui_debug_pause_iterations_ = 10;
   gui_debug_update_iterations_ = 10;
@@ -256,6 +286,217 @@ void Replace::doIncrementalPlace()
   }
 }
 
+void Replace::doWindowIncrementalPlace(const odb::Rect& region)
+{
+  odb::dbBlock* block = db_->getChip()->getBlock();
+  const odb::Rect core = block->getCoreArea();
+  if (!core.overlaps(region)) {
+    log_->error(GPL, 153, "Incremental window does not overlap the core area.");
+  }
+  const odb::Rect window = core.intersect(region);
+
+  // Our own moves must not show up as netlist edits.
+  stopEditRecording();
+
+  // Only the unplaced instances whose placed neighbors sit in the window
+  // belong to it; the rest of the design is left alone.
+  std::vector<odb::dbInst*> unplaced;
+  for (odb::dbInst* inst : block->getInsts()) {
+    if (!inst->getPlacementStatus().isPlaced()) {
+      unplaced.push_back(inst);
+    }
+  }
+  const int seeded = seedUnplacedInsts(unplaced, window, false);
+  if (seeded > 0) {
+    log_->info(GPL, 154, "Seeded {} unplaced instances.", seeded);
+  }
+
+  PlacerBaseVars pbVars;
+  pbVars.padLeft = padLeft_;
+  pbVars.padRight = padRight_;
+  pbVars.skipIoMode = skipIoMode_;
+  pbVars.useWindow = true;
+  pbVars.window = window;
+
+  for (odb::dbInst* inst : block->getInsts()) {
+    auto type = inst->getMaster()->getType();
+    if (inst->isFixed() || (!type.isCore() && !type.isBlock())) {
+      continue;
+    }
+    const odb::Rect bbox = inst->getBBox()->getBox();
+    if (window.intersects(odb::Point(bbox.xCenter(), bbox.yCenter()))) {
+      pbVars.windowInsts.insert(inst);
+    }
+  }
+
+  if (pbVars.windowInsts.empty()) {
+    log_->warn(GPL,
+               155,
+               "No movable instances in the incremental window - skipping "
+               "placement.");
+    return;
+  }
+
+  // The placeable set differs from any previous run, so start over.
+  ip_.reset();
+  np_.reset();
+  tb_.reset();
+  rb_.reset();
+  nbVec_.clear();
+  nbc_.reset();
+  pbVec_.clear();
+  pbc_.reset();
+
+  pbc_ = std::make_shared<PlacerBaseCommon>(db_, pbVars, log_);
+  pbVec_.push_back(std::make_shared<PlacerBase>(db_, pbc_, log_));
+
+  for (auto pd : block->getPowerDomains()) {
+    if (pd->getGroup()) {
+      auto pb = std::make_shared<PlacerBase>(db_, pbc_, log_, pd->getGroup());
+      if (!pb->placeInsts().empty()) {
+        pbVec_.push_back(pb);
+      }
+    }
+  }
+
+  total_placeable_insts_ = 0;
+  for (const auto& pb : pbVec_) {
+    total_placeable_insts_ += pb->placeInsts().size();
+  }
+
+  // Everything outside the window is fixed; re-deriving timing weights or
+  // routing congestion would cost a full-chip pass for little gain.
+  ScopedModeOverride timing_driven(timingDrivenMode_, false);
+  ScopedModeOverride routability_driven(routabilityDrivenMode_, false);
+
+  doNesterovPlace();
+}
+
+void Replace::doEditIncrementalPlace(int margin)
+{
+  odb::dbBlock* block = db_->getChip()->getBlock();
+  stopEditRecording();
+
+  if (editRecorder_->block() != block || editRecorder_->insts().empty()) {
+    log_->warn(GPL,
+               156,
+               "No recorded netlist edits - skipping incremental placement.");
+    return;
+  }
+
+  // New instances need a location before the window can be derived.
+  std::vector<odb::dbInst*> edited(editRecorder_->insts().begin(),
+                                   editRecorder_->insts().end());
+  seedUnplacedInsts(edited, block->getCoreArea(), true);
+
+  odb::Rect window;
+  window.mergeInit();
+  for (odb::dbInst* inst : editRecorder_->insts()) {
+    if (!inst->isFixed()) {
+      window.merge(inst->getBBox()->getBox());
+    }
+  }
+  editRecorder_->clear();
+
+  if (window.isInverted()) {
+    log_->warn(GPL,
+               157,
+               "All recorded netlist edits are fixed - skipping incremental "
+               "placement.");
+    return;
+  }
+
+  if (margin < 0) {
+    margin = 0;
+    for (odb::dbRow* row : block->getRows()) {
+      margin = 10 * row->getSite()->getHeight();
+      break;
+    }
+  }
+
+  odb::Rect region;
+  window.bloat(margin, region);
+  doWindowIncrementalPlace(region);
+}
+
+// Put the unplaced instances of insts at the centroid of their placed
+// neighbors so that nesterov starts from a sensible spot.  With clamp the
+// centroid is clamped to bounds (the center of bounds if there are no placed
+// neighbors); otherwise instances whose centroid is outside bounds are left
+// unplaced.
+int Replace::seedUnplacedInsts(const std::vector<odb::dbInst*>& insts,
+                               const odb::Rect& bounds,
+                               bool clamp)
+{
+  int seeded = 0;
+  for (odb::dbInst* inst : insts) {
+    auto type = inst->getMaster()->getType();
+    if (inst->getPlacementStatus().isPlaced()
+        || (!type.isCore() && !type.isBlock())) {
+      continue;
+    }
+
+    int64_t sumX = 0;
+    int64_t sumY = 0;
+    int cnt = 0;
+    for (odb::dbITerm* iterm : inst->getITerms()) {
+      odb::dbNet* net = iterm->getNet();
+      if (net == nullptr || net->getSigType().isSupply()
+          || static_cast<int>(net->getITerms().size())
+                 > initialPlaceMaxFanout_) {
+        continue;
+      }
+      for (odb::dbITerm* other : net->getITerms()) {
+        odb::dbInst* otherInst = other->getInst();
+        if (otherInst == inst || !otherInst->getPlacementStatus().isPlaced()) {
+          continue;
+        }
+        const odb::Rect box = otherInst->getBBox()->getBox();
+        sumX += box.xCenter();
+        sumY += box.yCenter();
+        ++cnt;
+      }
+      for (odb::dbBTerm* bterm : net->getBTerms()) {
+        int x, y;
+        if (bterm->getFirstPinLocation(x, y)) {
+          sumX += x;
+          sumY += y;
+          ++cnt;
+        }
+      }
+    }
+
+    odb::Point center(bounds.xCenter(), bounds.yCenter());
+    if (cnt > 0) {
+      center = odb::Point(sumX / cnt, sumY / cnt);
+      if (clamp) {
+        center = bounds.closestPtInside(center);
+      } else if (!bounds.intersects(center)) {
+        continue;
+      }
+    } else if (!clamp) {
+      continue;
+    }
+
+    odb::dbBox* bbox = inst->getBBox();
+    inst->setLocation(center.x() - bbox->getDX() / 2,
+                      center.y() - bbox->getDY() / 2);
+    inst->setPlacementStatus(odb::dbPlacementStatus::PLACED);
+    ++seeded;
+  }
+  return seeded;
+}
+
+void Replace::startEditRecording()
+{
+  editRecorder_->start(db_->getChip()->getBlock());
+}
+
+void Replace::stopEditRecording()
+{
+  editRecorder_->stop();
+}
+
 void Replace::doInitialPlace()
 {
   if (pbc_ == nullptr) {
@@ -289,6 +530,8 @@ void Replace::doInitialPlace()
   ipVars.netWeightScale = initialPlaceNetWeightScale_;
   ipVars.debug = gui_debug_initial_;
   ipVars.forceCPU = forceCPU_;
+  ipVars.parallelSolver = parallelInitialPlace_;
+  ipVars.numThreads = num_threads_;
 
   std::unique_ptr<InitialPlace> ip(
       new InitialPlace(ipVars, pbc_, pbVec_, log_));
@@ -338,7 +581,8 @@ bool Replace::initNesterovPlace()
 
     nbVars.useUniformTargetDensity = uniformTargetDensityMode_;
 
-    nbc_ = std::make_shared<NesterovBaseCommon>(nbVars, pbc_, log_);
+    nbc_ = std::make_shared<NesterovBaseCommon>(
+        nbVars, pbc_, log_, num_threads_);
 
     for (const auto& pb : pbVec_) {
       nbVec_.push_back(std::make_shared<NesterovBase>(nbVars, pb, nbc_, log_));
@@ -385,6 +629,8 @@ bool Replace::initNesterovPlace()
     npVars.debug_update_iterations = gui_debug_update_iterations_;
     npVars.debug_draw_bins = gui_debug_draw_bins_;
     npVars.debug_inst = gui_debug_inst_;
+    npVars.checkpointInterval = checkpointInterval_;
+    npVars.checkpointPrefix = checkpointPrefix_;
 
     for (const auto& nb : nbVec_) {
       nb->setNpVars(&npVars);
@@ -403,6 +649,10 @@ int Replace::doNesterovPlace(int start_iter)
   if (!initNesterovPlace()) {
     return 0;
   }
+  if (!resumeCheckpoint_.empty()) {
+    start_iter = np_->readCheckpoint(resumeCheckpoint_);
+    resumeCheckpoint_.clear();
+  }
   if (timingDrivenMode_)
     rs_->resizeSlackPreamble();
   return np_->doNesterovPlace(start_iter);
@@ -497,6 +747,17 @@ void Replace::setReferenceHpwl(float refHpwl)
   referenceHpwl_ = refHpwl;
 }
 
+void Replace::setCheckpoint(const std::string& prefix, int interval)
+{
+  checkpointPrefix_ = prefix;
+  checkpointInterval_ = interval;
+}
+
+void Replace::setResumeCheckpoint(const std::string& fileName)
+{
+  resumeCheckpoint_ = fileName;
+}
+
 void Replace::setDebug(int pause_iterations,
                        int update_iterations,
                        bool draw_bins,
@@ -521,6 +782,22 @@ void Replace::setForceCPU(bool force_cpu)
   forceCPU_ = force_cpu;
 }
 
+void Replace::setParallelInitialPlace(bool mode)
+{
+  parallelInitialPlace_ = mode;
+}
+
+void Replace::setNumThreads(int threads)
+{
+  num_threads_ = threads;
+  if (nbc_) {
+    nbc_->setNumThreads(threads);
+  }
+  for (auto& nb : nbVec_) {
+    nb->setNumThreads(threads);
+  }
+}
+
 void Replace::setTimingDrivenMode(bool mode)
 {
   timingDrivenMode_ = mode;
@@ -134,6 +134,48 @@ replace_incremental_place_cmd()
   replace->doIncrementalPlace();
 }
 
+void
+replace_window_incremental_place_cmd(int lx, int ly, int ux, int uy)
+{
+  Replace* replace = getReplace();
+  replace->doWindowIncrementalPlace(odb::Rect(lx, ly, ux, uy));
+}
+
+void
+replace_edit_incremental_place_cmd(int margin)
+{
+  Replace* replace = getReplace();
+  replace->doEditIncrementalPlace(margin);
+}
+
+void
+start_edit_recording_cmd()
+{
+  Replace* replace = getReplace();
+  replace->startEditRecording();
+}
+
+void
+stop_edit_recording_cmd()
+{
+  Replace* replace = getReplace();
+  replace->stopEditRecording();
+}
+
+
+void
+set_checkpoint_cmd(const char* prefix, int interval)
+{
+  Replace* replace = getReplace();
+  replace->setCheckpoint(prefix, interval);
+}
+
+void
+set_resume_checkpoint_cmd(const char* file_name)
+{
+  Replace* replace = getReplace();
+  replace->setResumeCheckpoint(file_name);
+}
 
 void
 set_force_cpu(bool force_cpu)
@@ -142,6 +184,20 @@ set_force_cpu(bool force_cpu)
   replace->setForceCPU(force_cpu);
 }
 
+void
+set_parallel_initial_place_cmd(bool mode)
+{
+  Replace* replace = getReplace();
+  replace->setParallelInitialPlace(mode);
+}
+
+void
+set_num_threads_cmd(int threads)
+{
+  Replace* replace = getReplace();
+  replace->setNumThreads(threads);
+}
+
 void set_timing_driven_mode(bool timing_driven)
 {
   Replace* replace = getReplace();
@@ -39,7 +39,12 @@ sta::define_cmd_args "global_placement" {\
     [-disable_timing_driven]\
     [-disable_routability_driven]\
     [-incremental]\
+    [-window {lx ly ux uy}]\
+    [-edited]\
+    [-window_margin window_margin]\
+    [-record_edits]\
     [-force_cpu]\
+    [-parallel_initial_place]\
     [-skip_io]\
     [-bin_grid_count grid_count]\
     [-density target_density]\
@@ -64,6 +69,9 @@ sta::define_cmd_args "global_placement" {\
     [-timing_driven_nets_percentage timing_driven_nets_percentage]\
     [-pad_left pad_left]\
     [-pad_right pad_right]\
+    [-checkpoint_prefix checkpoint_prefix]\
+    [-checkpoint_interval checkpoint_interval]\
+    [-resume_checkpoint checkpoint_file]\
 }
 
 proc global_placement { args } {
@@ -82,7 +90,9 @@ proc global_placement { args } {
       -timing_driven_net_reweight_overflow \
       -timing_driven_net_weight_max \
       -timing_driven_nets_percentage \
-      -pad_left -pad_right} \
+      -pad_left -pad_right \
+      -window -window_margin \
+      -checkpoint_prefix -checkpoint_interval -resume_checkpoint} \
     flags {-skip_initial_place \
       -skip_nesterov_place \
       -timing_driven \
@@ -91,7 +101,10 @@ proc global_placement { args } {
       -disable_routability_driven \
       -skip_io \
       -incremental\
-      -force_cpu}
+      -edited\
+      -record_edits\
+      -force_cpu\
+      -parallel_initial_place}
 
   # flow control for initial_place
   if { [info exists flags(-skip_initial_place)] } {
@@ -105,6 +118,11 @@ proc global_placement { args } {
   set force_cpu [info exists flags(-force_cpu)]
   gpl::set_force_cpu $force_cpu
 
+  set parallel_initial_place [info exists flags(-parallel_initial_place)]
+  gpl::set_parallel_initial_place_cmd $parallel_initial_place
+
+  gpl::set_num_threads_cmd [ord::thread_count]
+
   set skip_io [info exists flags(-skip_io)]
   gpl::set_skip_io_mode_cmd $skip_io
   if { $skip_io } {
@@ -302,19 +320,76 @@ proc global_placement { args } {
     gpl::set_pad_right_cmd $pad_right
   }
 
+  if { [info exists keys(-checkpoint_interval)] } {
+    set checkpoint_interval $keys(-checkpoint_interval)
+    sta::check_positive_integer "-checkpoint_interval" $checkpoint_interval
+    set checkpoint_prefix "gpl"
+    if { [info exists keys(-checkpoint_prefix)] } {
+      set checkpoint_prefix $keys(-checkpoint_prefix)
+    }
+    gpl::set_checkpoint_cmd $checkpoint_prefix $checkpoint_interval
+  } elseif { [info exists keys(-checkpoint_prefix)] } {
+    utl::warn "GPL" 170 "-checkpoint_prefix is ignored without -checkpoint_interval."
+  }
+
+  set resume [info exists keys(-resume_checkpoint)]
+  if { $resume } {
+    if { [info exists flags(-incremental)] } {
+      utl::error GPL 169 "-resume_checkpoint cannot be used with -incremental."
+    }
+    gpl::set_resume_checkpoint_cmd [file normalize $keys(-resume_checkpoint)]
+  }
+
+  if { ![info exists flags(-incremental)] \
+         && ([info exists keys(-window)] || [info exists flags(-edited)]) } {
+    utl::error GPL 159 "-window and -edited require -incremental."
+  }
+
   if { [ord::db_has_rows] } {
     sta::check_argc_eq0 "global_placement" $args
   
+    # Edits made by gpl itself are not recorded.
+    gpl::stop_edit_recording_cmd
+
     if { [info exists flags(-incremental)] } {
-      gpl::replace_incremental_place_cmd
+      if { [info exists keys(-window)] } {
+        set window $keys(-window)
+        if { [llength $window] != 4 } {
+          utl::error GPL 158 "-window must be a list of 4 values."
+        }
+        lassign $window lx ly ux uy
+        sta::check_float "-window" $lx
+        sta::check_float "-window" $ly
+        sta::check_float "-window" $ux
+        sta::check_float "-window" $uy
+        gpl::replace_window_incremental_place_cmd \
+          [ord::microns_to_dbu $lx] [ord::microns_to_dbu $ly] \
+          [ord::microns_to_dbu $ux] [ord::microns_to_dbu $uy]
+      } elseif { [info exists flags(-edited)] } {
+        set margin -1
+        if { [info exists keys(-window_margin)] } {
+          set margin $keys(-window_margin)
+          sta::check_positive_float "-window_margin" $margin
+          set margin [ord::microns_to_dbu $margin]
+        }
+        gpl::replace_edit_incremental_place_cmd $margin
+      } else {
+        gpl::replace_incremental_place_cmd
+      }
     } else {
-      gpl::replace_initial_place_cmd
+      # The checkpoint already holds the placement to continue from.
+      if { !$resume } {
+        gpl::replace_initial_place_cmd
+      }
 
       if { ![info exists flags(-skip_nesterov_place)] } {
         gpl::replace_nesterov_place_cmd
       }
     }
     gpl::replace_reset_cmd
+    if { [info exists flags(-record_edits)] } {
+      gpl::start_edit_recording_cmd
+    }
   } else {
     utl::error GPL 130 "No rows defined in design. Use initialize_floorplan to add rows."
   }
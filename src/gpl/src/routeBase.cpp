@@ -39,6 +39,7 @@
 #include <string>
 #include <utility>
 
+#include "checkpoint.h"
 #include "grt/GlobalRouter.h"
 #include "nesterovBase.h"
 #include "odb/db.h"
@@ -382,6 +383,42 @@ void RouteBase::getGlobalRouterResult()
   updateRoute();
 }
 
+void RouteBase::writeCheckpoint(CheckpointWriter& writer) const
+{
+  writer.write(inflatedAreaDelta_);
+  writer.write(bloatIterCnt_);
+  writer.write(inflationIterCnt_);
+  writer.write(numCall_);
+  writer.write(minRc_);
+  writer.write(minRcTargetDensity_);
+  writer.write(minRcViolatedCnt_);
+
+  std::vector<int> cellSizes;
+  cellSizes.reserve(minRcCellSize_.size() * 2);
+  for (const auto& size : minRcCellSize_) {
+    cellSizes.push_back(size.first);
+    cellSizes.push_back(size.second);
+  }
+  writer.write(cellSizes);
+}
+
+void RouteBase::readCheckpoint(CheckpointReader& reader)
+{
+  reader.read(inflatedAreaDelta_);
+  reader.read(bloatIterCnt_);
+  reader.read(inflationIterCnt_);
+  reader.read(numCall_);
+  reader.read(minRc_);
+  reader.read(minRcTargetDensity_);
+  reader.read(minRcViolatedCnt_);
+
+  std::vector<int> cellSizes;
+  reader.read(cellSizes, minRcCellSize_.size() * 2);
+  for (size_t i = 0; i < minRcCellSize_.size() && reader.ok(); i++) {
+    minRcCellSize_[i] = std::make_pair(cellSizes[2 * i], cellSizes[2 * i + 1]);
+  }
+}
+
 int64_t RouteBase::inflatedAreaDelta() const
 {
   return inflatedAreaDelta_;
@@ -54,6 +54,8 @@ class NesterovBaseCommon;
 class NesterovBase;
 class GNet;
 class Die;
+class CheckpointReader;
+class CheckpointWriter;
 
 // for GGrid
 class Tile
@@ -247,6 +249,10 @@ class RouteBase
 
   void revertGCellSizeToMinRc();
 
+  // save/restore the routability loop counters and min-RC solution
+  void writeCheckpoint(CheckpointWriter& writer) const;
+  void readCheckpoint(CheckpointReader& reader);
+
  private:
   RouteBaseVars rbVars_;
   odb::dbDatabase* db_;
@@ -35,6 +35,11 @@
 
 #include "solver.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 namespace gpl {
 
 #ifdef ENABLE_GPU
@@ -80,4 +85,150 @@ ResidualError cpuSparseSolve(int maxSolverIter,
   error.y = solver.error();
   return error;
 }
+
+// Reductions are summed per fixed-size block and then in block order so
+// that the result is the same for any thread count.
+static constexpr int reduceBlockSize = 4096;
+
+static double blockedDot(const float* a,
+                         const float* b,
+                         int n,
+                         int numThreads)
+{
+  const int blockCnt = (n + reduceBlockSize - 1) / reduceBlockSize;
+  std::vector<double> partial(blockCnt, 0.0);
+#pragma omp parallel for num_threads(numThreads)
+  for (int blk = 0; blk < blockCnt; blk++) {
+    const int end = std::min(n, (blk + 1) * reduceBlockSize);
+    double sum = 0;
+    for (int i = blk * reduceBlockSize; i < end; i++) {
+      sum += static_cast<double>(a[i]) * b[i];
+    }
+    partial[blk] = sum;
+  }
+
+  double sum = 0;
+  for (double p : partial) {
+    sum += p;
+  }
+  return sum;
+}
+
+// out = A * in; rows are independent.
+static void csrSpMV(const SMatrix& A,
+                    const float* in,
+                    float* out,
+                    int numThreads)
+{
+  const int rows = A.rows();
+  const int* rowStart = A.outerIndexPtr();
+  const int* cols = A.innerIndexPtr();
+  const float* vals = A.valuePtr();
+#pragma omp parallel for num_threads(numThreads) schedule(static, 1024)
+  for (int row = 0; row < rows; row++) {
+    float sum = 0;
+    for (int k = rowStart[row]; k < rowStart[row + 1]; k++) {
+      sum += vals[k] * in[cols[k]];
+    }
+    out[row] = sum;
+  }
+}
+
+static float parallelCG(int maxSolverIter,
+                        int numThreads,
+                        const SMatrix& A,
+                        const Eigen::VectorXf& b,
+                        Eigen::VectorXf& x)
+{
+  const int n = b.size();
+  if (n == 0) {
+    return 0;
+  }
+  const double bNorm = std::sqrt(blockedDot(b.data(), b.data(), n, numThreads));
+  if (bNorm == 0) {
+    x.setZero();
+    return 0;
+  }
+
+  // Jacobi preconditioner; rows without entries keep a unit scale.
+  const int* rowStart = A.outerIndexPtr();
+  const int* cols = A.innerIndexPtr();
+  const float* vals = A.valuePtr();
+  std::vector<float> invDiag(n, 1.0f);
+#pragma omp parallel for num_threads(numThreads)
+  for (int row = 0; row < n; row++) {
+    for (int k = rowStart[row]; k < rowStart[row + 1]; k++) {
+      if (cols[k] == row && vals[k] != 0) {
+        invDiag[row] = 1.0f / vals[k];
+        break;
+      }
+    }
+  }
+
+  std::vector<float> r(n), z(n), p(n), q(n);
+
+  // r = b - A * x (x is the warm start)
+  csrSpMV(A, x.data(), q.data(), numThreads);
+#pragma omp parallel for num_threads(numThreads)
+  for (int i = 0; i < n; i++) {
+    r[i] = b[i] - q[i];
+    z[i] = invDiag[i] * r[i];
+    p[i] = z[i];
+  }
+
+  double rz = blockedDot(r.data(), z.data(), n, numThreads);
+  double residual = std::sqrt(blockedDot(r.data(), r.data(), n, numThreads));
+  const double tolerance = std::numeric_limits<float>::epsilon() * bNorm;
+
+  for (int iter = 0; iter < maxSolverIter && residual > tolerance; iter++) {
+    csrSpMV(A, p.data(), q.data(), numThreads);
+    const double pq = blockedDot(p.data(), q.data(), n, numThreads);
+    if (pq == 0) {
+      break;
+    }
+    const float alpha = rz / pq;
+
+#pragma omp parallel for num_threads(numThreads)
+    for (int i = 0; i < n; i++) {
+      x[i] += alpha * p[i];
+      r[i] -= alpha * q[i];
+      z[i] = invDiag[i] * r[i];
+    }
+
+    residual = std::sqrt(blockedDot(r.data(), r.data(), n, numThreads));
+    const double rzNew = blockedDot(r.data(), z.data(), n, numThreads);
+    const float beta = rzNew / rz;
+    rz = rzNew;
+
+#pragma omp parallel for num_threads(numThreads)
+    for (int i = 0; i < n; i++) {
+      p[i] = z[i] + beta * p[i];
+    }
+  }
+
+  return residual / bNorm;
+}
+
+ResidualError cpuParallelSparseSolve(int maxSolverIter,
+                                     int numThreads,
+                                     const SMatrix& placeInstForceMatrixX,
+                                     const Eigen::VectorXf& fixedInstForceVecX,
+                                     Eigen::VectorXf& instLocVecX,
+                                     const SMatrix& placeInstForceMatrixY,
+                                     const Eigen::VectorXf& fixedInstForceVecY,
+                                     Eigen::VectorXf& instLocVecY)
+{
+  ResidualError error;
+  error.x = parallelCG(maxSolverIter,
+                       numThreads,
+                       placeInstForceMatrixX,
+                       fixedInstForceVecX,
+                       instLocVecX);
+  error.y = parallelCG(maxSolverIter,
+                       numThreads,
+                       placeInstForceMatrixY,
+                       fixedInstForceVecY,
+                       instLocVecY);
+  return error;
+}
 }  // namespace gpl
\ No newline at end of file
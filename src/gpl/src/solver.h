@@ -85,4 +85,16 @@ ResidualError cpuSparseSolve(int maxSolverIter,
                              Eigen::VectorXf& fixedInstForceVecY,
                              Eigen::VectorXf& instLocVecY,
                              utl::Logger* logger);
+
+// Jacobi-preconditioned conjugate gradient on the CSR (row-major) B2B
+// matrices, multithreaded with OpenMP.  instLocVec holds the warm start
+// on entry.  Results do not depend on numThreads.
+ResidualError cpuParallelSparseSolve(int maxSolverIter,
+                                     int numThreads,
+                                     const SMatrix& placeInstForceMatrixX,
+                                     const Eigen::VectorXf& fixedInstForceVecX,
+                                     Eigen::VectorXf& instLocVecX,
+                                     const SMatrix& placeInstForceMatrixY,
+                                     const Eigen::VectorXf& fixedInstForceVecY,
+                                     Eigen::VectorXf& instLocVecY);
 }  // namespace gpl
@@ -37,6 +37,7 @@
 #include <cmath>
 #include <utility>
 
+#include "checkpoint.h"
 #include "nesterovBase.h"
 #include "placerBase.h"
 #include "rsz/Resizer.hh"
@@ -208,4 +209,20 @@ bool TimingBase::updateGNetWeights(float overflow)
   return true;
 }
 
+void TimingBase::writeCheckpoint(CheckpointWriter& writer) const
+{
+  writer.write(timingOverflowChk_);
+}
+
+void TimingBase::readCheckpoint(CheckpointReader& reader)
+{
+  std::vector<int> overflowChk;
+  reader.read(overflowChk);
+  // The resumed run may use a different overflow list; only carry over
+  // the progress when it still lines up.
+  if (reader.ok() && overflowChk.size() == timingOverflowChk_.size()) {
+    timingOverflowChk_ = overflowChk;
+  }
+}
+
 }  // namespace gpl
@@ -48,6 +48,8 @@ namespace gpl {
 
 class NesterovBaseCommon;
 class GNet;
+class CheckpointReader;
+class CheckpointWriter;
 
 class TimingBase
 {
@@ -72,6 +74,10 @@ class TimingBase
   // False: no slacks found
   bool updateGNetWeights(float overflow);
 
+  // save/restore which reweight overflows were already consumed
+  void writeCheckpoint(CheckpointWriter& writer) const;
+  void readCheckpoint(CheckpointReader& reader);
+
  private:
   rsz::Resizer* rs_;
   utl::Logger* log_;
@@ -0,0 +1,161 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#include "waKernel.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GPL_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+namespace gpl {
+
+static void batchFastExpScalar(const float* arg,
+                               float* out,
+                               int count,
+                               float minBar)
+{
+  for (int i = 0; i < count; i++) {
+    const float a = arg[i];
+    out[i] = (a > minBar) ? fastExp(a) : 0.0f;
+  }
+}
+
+#ifdef GPL_X86_SIMD
+
+__attribute__((target("avx2"))) static void
+batchFastExpAvx2(const float* arg, float* out, int count, float minBar)
+{
+  const __m256 one = _mm256_set1_ps(1.0f);
+  const __m256 scale = _mm256_set1_ps(1.0f / 1024.0f);
+  const __m256 bar = _mm256_set1_ps(minBar);
+
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    const __m256 a = _mm256_loadu_ps(arg + i);
+    // 1/1024 is exact so the multiply matches the scalar divide.
+    __m256 v = _mm256_add_ps(one, _mm256_mul_ps(a, scale));
+    for (int k = 0; k < 10; k++) {
+      v = _mm256_mul_ps(v, v);
+    }
+    const __m256 mask = _mm256_cmp_ps(a, bar, _CMP_GT_OQ);
+    _mm256_storeu_ps(out + i, _mm256_and_ps(v, mask));
+  }
+  batchFastExpScalar(arg + i, out + i, count - i, minBar);
+}
+
+__attribute__((target("avx512f"))) static void
+batchFastExpAvx512(const float* arg, float* out, int count, float minBar)
+{
+  const __m512 one = _mm512_set1_ps(1.0f);
+  const __m512 scale = _mm512_set1_ps(1.0f / 1024.0f);
+  const __m512 bar = _mm512_set1_ps(minBar);
+
+  int i = 0;
+  for (; i + 16 <= count; i += 16) {
+    const __m512 a = _mm512_loadu_ps(arg + i);
+    __m512 v = _mm512_add_ps(one, _mm512_mul_ps(a, scale));
+    for (int k = 0; k < 10; k++) {
+      v = _mm512_mul_ps(v, v);
+    }
+    const __mmask16 mask = _mm512_cmp_ps_mask(a, bar, _CMP_GT_OQ);
+    _mm512_storeu_ps(out + i, _mm512_maskz_mov_ps(mask, v));
+  }
+  batchFastExpScalar(arg + i, out + i, count - i, minBar);
+}
+
+#endif
+
+SimdLevel detectSimdLevel()
+{
+#ifdef GPL_X86_SIMD
+  static const SimdLevel level = [] {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+      return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+      return SimdLevel::Avx2;
+    }
+    return SimdLevel::Scalar;
+  }();
+  return level;
+#else
+  return SimdLevel::Scalar;
+#endif
+}
+
+const char* simdLevelName(SimdLevel level)
+{
+  switch (level) {
+    case SimdLevel::Scalar:
+      return "scalar";
+    case SimdLevel::Avx2:
+      return "avx2";
+    case SimdLevel::Avx512:
+      return "avx512";
+  }
+  return "unknown";
+}
+
+void batchFastExp(const float* arg,
+                  float* out,
+                  int count,
+                  float minBar,
+                  SimdLevel level)
+{
+#ifdef GPL_X86_SIMD
+  // never run an instruction set the CPU doesn't have
+  if (level > detectSimdLevel()) {
+    level = detectSimdLevel();
+  }
+  switch (level) {
+    case SimdLevel::Avx512:
+      batchFastExpAvx512(arg, out, count, minBar);
+      return;
+    case SimdLevel::Avx2:
+      batchFastExpAvx2(arg, out, count, minBar);
+      return;
+    case SimdLevel::Scalar:
+      break;
+  }
+#endif
+  batchFastExpScalar(arg, out, count, minBar);
+}
+
+void batchFastExp(const float* arg, float* out, int count, float minBar)
+{
+  batchFastExp(arg, out, count, minBar, detectSimdLevel());
+}
+
+}  // namespace gpl
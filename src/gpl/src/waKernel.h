@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2023, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+///////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+namespace gpl {
+
+// Instruction set used by the batched WA kernels.
+enum class SimdLevel
+{
+  Scalar,
+  Avx2,
+  Avx512
+};
+
+// Highest level supported by both the build and the running CPU.
+SimdLevel detectSimdLevel();
+const char* simdLevelName(SimdLevel level);
+
+// exp(a) approximated as (1 + a/1024)^1024.
+// Only accurate for a <= 0, which is always the case for the
+// shifted WA terms.
+inline float fastExp(float a)
+{
+  a = 1.0f + a / 1024.0f;
+  a *= a;
+  a *= a;
+  a *= a;
+  a *= a;
+  a *= a;
+  a *= a;
+  a *= a;
+  a *= a;
+  a *= a;
+  a *= a;
+  return a;
+}
+
+// out[i] = fastExp(arg[i]) if arg[i] > minBar, 0 otherwise.
+// arg and out may alias.
+void batchFastExp(const float* arg,
+                  float* out,
+                  int count,
+                  float minBar,
+                  SimdLevel level);
+
+// Same as above using detectSimdLevel().
+void batchFastExp(const float* arg, float* out, int count, float minBar);
+
+// Accumulate the WA sums of one net:
+//   expSum  += sum(exp[i])
+//   xExpSum += sum(x[i] * exp[i])
+// The pins are summed in order so the result does not depend on the
+// SIMD level.
+inline void waReduce(const float* exp,
+                     const int* x,
+                     int count,
+                     float& expSum,
+                     float& xExpSum)
+{
+  for (int i = 0; i < count; i++) {
+    expSum += exp[i];
+    xExpSum += x[i] * exp[i];
+  }
+}
+
+}  // namespace gpl
@@ -0,0 +1,30 @@
+# Resuming Nesterov placement from a checkpoint must give the same result as
+# the uninterrupted run that wrote it.
+source helpers.tcl
+set test_name checkpoint01
+read_lef ./nangate45.lef
+read_def ./simple01.def
+
+set prefix [make_result_file $test_name]
+global_placement -init_density_penalty 0.01 -skip_initial_place \
+  -checkpoint_prefix $prefix -checkpoint_interval 100
+set full_def [make_result_file ${test_name}_full.def]
+write_def $full_def
+
+# Scramble the placement so that only the checkpoint can restore it.
+foreach inst [[ord::get_db_block] getInsts] {
+  if { [$inst getPlacementStatus] == "PLACED" } {
+    $inst setLocation 0 0
+  }
+}
+
+global_placement -init_density_penalty 0.01 \
+  -resume_checkpoint ${prefix}_100.ckpt
+set resumed_def [make_result_file ${test_name}_resumed.def]
+write_def $resumed_def
+
+if { [diff_files $full_def $resumed_def] != 0 } {
+  puts "fail: resumed placement differs from the uninterrupted run"
+  exit 1
+}
+puts "pass"
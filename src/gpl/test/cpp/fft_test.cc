@@ -0,0 +1,106 @@
+#include <omp.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "fft.h"
+#include "gtest/gtest.h"
+
+namespace gpl {
+
+using Grid = std::vector<std::vector<float>>;
+
+static Grid makeDensity(int cntX, int cntY)
+{
+  std::mt19937 gen(42);
+  std::uniform_real_distribution<float> dist(0.0f, 1.5f);
+  Grid density(cntX, std::vector<float>(cntY));
+  for (auto& column : density) {
+    for (float& d : column) {
+      d = dist(gen);
+    }
+  }
+  return density;
+}
+
+struct FFTResult
+{
+  Grid phi;
+  Grid forceX;
+  Grid forceY;
+};
+
+static FFTResult runFFT(const Grid& density, int binSize, int threads)
+{
+  const int cntX = density.size();
+  const int cntY = density[0].size();
+  FFT fft(cntX, cntY, binSize, binSize);
+  fft.setNumThreads(threads);
+  for (int x = 0; x < cntX; x++) {
+    for (int y = 0; y < cntY; y++) {
+      fft.updateDensity(x, y, density[x][y]);
+    }
+  }
+  fft.doFFT();
+
+  FFTResult result{Grid(cntX, std::vector<float>(cntY)),
+                   Grid(cntX, std::vector<float>(cntY)),
+                   Grid(cntX, std::vector<float>(cntY))};
+  for (int x = 0; x < cntX; x++) {
+    for (int y = 0; y < cntY; y++) {
+      result.phi[x][y] = fft.getElectroPhi(x, y);
+      auto force = fft.getElectroForce(x, y);
+      result.forceX[x][y] = force.first;
+      result.forceY[x][y] = force.second;
+    }
+  }
+  return result;
+}
+
+// The threaded transforms must not change a single bit.
+TEST(FFT, ThreadCountInvariant)
+{
+  const Grid density = makeDensity(128, 64);
+  const FFTResult serial = runFFT(density, 100, 1);
+  for (int threads : {2, 3, 8}) {
+    const FFTResult parallel = runFFT(density, 100, threads);
+    EXPECT_EQ(serial.phi, parallel.phi) << threads;
+    EXPECT_EQ(serial.forceX, parallel.forceX) << threads;
+    EXPECT_EQ(serial.forceY, parallel.forceY) << threads;
+  }
+}
+
+// Uniform density has no field.
+TEST(FFT, UniformDensity)
+{
+  const Grid density(32, std::vector<float>(32, 0.7f));
+  const FFTResult result = runFFT(density, 10, 4);
+  for (int x = 0; x < 32; x++) {
+    for (int y = 0; y < 32; y++) {
+      EXPECT_NEAR(result.forceX[x][y], 0.0f, 1e-4);
+      EXPECT_NEAR(result.forceY[x][y], 0.0f, 1e-4);
+    }
+  }
+}
+
+// Runtime of the electrostatic field computation on a 2048x2048 grid.
+TEST(FFT, Benchmark2048)
+{
+  const Grid density = makeDensity(2048, 2048);
+  std::vector<int> threadCounts{1};
+  for (int t = 2; t <= omp_get_max_threads(); t *= 2) {
+    threadCounts.push_back(t);
+  }
+  for (int threads : threadCounts) {
+    const auto start = std::chrono::steady_clock::now();
+    runFFT(density, 100, threads);
+    const std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    printf("2048x2048 threads %3d: %.3f s\n", threads, elapsed.count());
+  }
+}
+
+}  // namespace gpl
@@ -0,0 +1,101 @@
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "waKernel.h"
+
+namespace gpl {
+
+static constexpr float kMinForceBar = -300;
+
+// Exponent arguments as produced by the WA model: always <= 0,
+// with some below minWireLengthForceBar.
+static std::vector<float> makeArgs(int count)
+{
+  std::mt19937 gen(1234);
+  std::uniform_real_distribution<float> dist(-400.0f, 0.0f);
+  std::vector<float> args(count);
+  for (float& arg : args) {
+    arg = dist(gen);
+  }
+  // exact cases
+  args[0] = 0.0f;
+  args[1] = kMinForceBar;
+  return args;
+}
+
+static std::vector<SimdLevel> supportedLevels()
+{
+  std::vector<SimdLevel> levels{SimdLevel::Scalar};
+  if (detectSimdLevel() >= SimdLevel::Avx2) {
+    levels.push_back(SimdLevel::Avx2);
+  }
+  if (detectSimdLevel() >= SimdLevel::Avx512) {
+    levels.push_back(SimdLevel::Avx512);
+  }
+  return levels;
+}
+
+TEST(WaKernel, MatchesScalarFastExp)
+{
+  // odd size to exercise the scalar tail of the SIMD loops
+  const std::vector<float> args = makeArgs(1003);
+
+  for (SimdLevel level : supportedLevels()) {
+    std::vector<float> out(args.size());
+    batchFastExp(args.data(), out.data(), args.size(), kMinForceBar, level);
+    for (size_t i = 0; i < args.size(); i++) {
+      const float expected
+          = (args[i] > kMinForceBar) ? fastExp(args[i]) : 0.0f;
+      EXPECT_FLOAT_EQ(out[i], expected)
+          << simdLevelName(level) << " arg " << args[i];
+    }
+  }
+}
+
+TEST(WaKernel, InPlace)
+{
+  std::vector<float> values = makeArgs(37);
+  const std::vector<float> args = values;
+  batchFastExp(values.data(), values.data(), values.size(), kMinForceBar);
+  for (size_t i = 0; i < args.size(); i++) {
+    const float expected = (args[i] > kMinForceBar) ? fastExp(args[i]) : 0.0f;
+    EXPECT_FLOAT_EQ(values[i], expected);
+  }
+}
+
+TEST(WaKernel, Reduce)
+{
+  const float exps[] = {1.0f, 0.5f, 0.0f, 0.25f};
+  const int xs[] = {10, 20, 30, 40};
+  float expSum = 0, xExpSum = 0;
+  waReduce(exps, xs, 4, expSum, xExpSum);
+  EXPECT_FLOAT_EQ(expSum, 1.75f);
+  EXPECT_FLOAT_EQ(xExpSum, 10.0f + 10.0f + 10.0f);
+}
+
+// Throughput of every supported level in pins/second.
+// Each pin needs four exponentials (min/max in x and y).
+TEST(WaKernel, Throughput)
+{
+  constexpr int pinCnt = 1 << 20;
+  constexpr int repeat = 20;
+  const std::vector<float> args = makeArgs(pinCnt);
+  std::vector<float> out(pinCnt);
+
+  for (SimdLevel level : supportedLevels()) {
+    const auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < repeat * 4; r++) {
+      batchFastExp(args.data(), out.data(), pinCnt, kMinForceBar, level);
+    }
+    const std::chrono::duration<double> elapsed
+        = std::chrono::steady_clock::now() - start;
+    printf("%-8s %8.1f Mpins/s\n",
+           simdLevelName(level),
+           pinCnt * repeat / elapsed.count() / 1e6);
+  }
+}
+
+}  // namespace gpl
@@ -0,0 +1,109 @@
+# Windowed and edit-driven incremental placement must only move the
+# instances inside the window.
+source helpers.tcl
+read_lef ./nangate45.lef
+read_def ./simple01.defok
+
+set block [ord::get_db_block]
+set dbu [[ord::get_db_tech] getDbUnitsPerMicron]
+
+proc inst_center { inst } {
+  set box [$inst getBBox]
+  return [list [expr ([$box xMin] + [$box xMax]) / 2] \
+            [expr ([$box yMin] + [$box yMax]) / 2]]
+}
+
+proc in_window { inst window } {
+  lassign [inst_center $inst] x y
+  lassign $window lx ly ux uy
+  return [expr $x >= $lx && $x <= $ux && $y >= $ly && $y <= $uy]
+}
+
+proc save_origins { block } {
+  set origins {}
+  foreach inst [$block getInsts] {
+    dict set origins [$inst getName] [$inst getOrigin]
+  }
+  return $origins
+}
+
+# Fail if an instance outside window moved, or if nothing moved when
+# require_move is set.
+proc check_moves { block origins window require_move } {
+  set moved 0
+  foreach inst [$block getInsts] {
+    set name [$inst getName]
+    if { [$inst getPlacementStatus] == "NONE" } {
+      continue
+    }
+    if { [in_window $inst $window] } {
+      if { [$inst getOrigin] != [dict get $origins $name] } {
+        incr moved
+      }
+    } elseif { [$inst getOrigin] != [dict get $origins $name] } {
+      puts "fail: $name outside the window moved"
+      exit 1
+    }
+  }
+  if { $require_move && $moved == 0 } {
+    puts "fail: no instance in the window moved"
+    exit 1
+  }
+}
+
+# gpl snaps the window outwards onto the site grid, so check against a
+# slightly grown window.
+set window_um {8 8 20 20}
+set slack [expr 2 * $dbu]
+set window {}
+foreach v $window_um {
+  lappend window [expr $v * $dbu]
+}
+lassign $window lx ly ux uy
+set check_window [list [expr $lx - $slack] [expr $ly - $slack] \
+                    [expr $ux + $slack] [expr $uy + $slack]]
+
+# An unplaced instance far from the window must not be pulled into it.
+set far_inst ""
+set far_dist 0
+foreach inst [$block getInsts] {
+  lassign [inst_center $inst] x y
+  set dist [expr abs($x - ($lx + $ux) / 2) + abs($y - ($ly + $uy) / 2)]
+  if { $dist > $far_dist } {
+    set far_dist $dist
+    set far_inst $inst
+  }
+}
+$far_inst setPlacementStatus NONE
+
+set origins [save_origins $block]
+global_placement -incremental -window $window_um -record_edits
+check_moves $block $origins $check_window 1
+if { [$far_inst getPlacementStatus] != "NONE" } {
+  puts "fail: [$far_inst getName] was seeded into the window"
+  exit 1
+}
+$far_inst setPlacementStatus PLACED
+
+# Move one instance by hand and re-place around it.
+set edited ""
+foreach inst [$block getInsts] {
+  if { [in_window $inst $window] } {
+    set edited $inst
+    break
+  }
+}
+lassign [$edited getOrigin] x y
+$edited setOrigin [expr $x + $dbu] $y
+
+set margin_um 3
+set box [$edited getBBox]
+set margin [expr ($margin_um + 2) * $dbu]
+set edit_window [list [expr [$box xMin] - $margin] [expr [$box yMin] - $margin] \
+                   [expr [$box xMax] + $margin] [expr [$box yMax] + $margin]]
+
+set origins [save_origins $block]
+global_placement -incremental -edited -window_margin $margin_um
+check_moves $block $origins $edit_window 0
+
+puts "pass"
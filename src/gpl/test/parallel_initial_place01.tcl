@@ -0,0 +1,34 @@
+# The multithreaded initial place solver must give the same placement for
+# any thread count.
+source helpers.tcl
+set test_name parallel_initial_place01
+read_lef ./nangate45.lef
+read_def ./simple01.def
+
+set block [ord::get_db_block]
+set start {}
+foreach inst [$block getInsts] {
+  dict set start [$inst getName] \
+    [list [$inst getOrigin] [$inst getPlacementStatus]]
+}
+
+set def_files {}
+foreach threads {1 4} {
+  foreach inst [$block getInsts] {
+    lassign [dict get $start [$inst getName]] origin status
+    $inst setOrigin {*}$origin
+    $inst setPlacementStatus $status
+  }
+  set_thread_count $threads
+  global_placement -init_density_penalty 0.01 -parallel_initial_place \
+    -skip_nesterov_place
+  set def_file [make_result_file ${test_name}_$threads.def]
+  write_def $def_file
+  lappend def_files $def_file
+}
+
+if { [diff_files {*}$def_files] != 0 } {
+  puts "fail: initial placement depends on the thread count"
+  exit 1
+}
+puts "pass"
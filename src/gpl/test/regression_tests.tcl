@@ -26,3 +26,8 @@ record_tests {
   convergence01
   nograd01
 }
+record_pass_fail_tests {
+  incremental_window
+  checkpoint01
+  parallel_initial_place01
+}
@@ -169,6 +169,7 @@ class GlobalRouter : public ant::GlobalRouteSource
                            int layer,
                            float reduction_percentage);
   void setVerbose(const bool v);
+  void setNumThreads(int threads);
   void setOverflowIterations(int iterations);
   void setCongestionReportIterStep(int congestion_report_iter_step);
   void setCongestionReportFile(const char* file_name);
@@ -349,7 +350,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   void checkPinPlacement();
 
   // incremental funcions
-  void updateDirtyRoutes();
+  std::vector<odb::dbNet*> updateDirtyRoutes();
   void mergeResults(NetRouteMap& routes);
   void updateDirtyNets(std::vector<Net*>& dirty_nets);
   void updateDbCongestion();
@@ -420,6 +421,7 @@ class GlobalRouter : public ant::GlobalRouteSource
   std::vector<RegionAdjustment> region_adjustments_;
 
   bool verbose_;
+  int num_threads_;
   int min_layer_for_clock_;
   int max_layer_for_clock_;
   float critical_nets_percentage_;
@@ -485,8 +487,9 @@ class IncrementalGRoute
  public:
   // Saves global router state and enables db callbacks.
   IncrementalGRoute(GlobalRouter* groute, odb::dbBlock* block);
-  // Update global routes for dirty nets.
-  void updateRoutes();
+  // Update global routes for dirty nets and return the nets whose
+  // routes changed so callers can refresh only their parasitics.
+  std::vector<odb::dbNet*> updateRoutes();
   // Disables db callbacks.
   ~IncrementalGRoute();
 
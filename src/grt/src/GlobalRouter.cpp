@@ -97,6 +97,7 @@ GlobalRouter::GlobalRouter()
       allow_congestion_(false),
       macro_extension_(0),
       verbose_(false),
+      num_threads_(1),
       min_layer_for_clock_(-1),
       max_layer_for_clock_(-2),
       critical_nets_percentage_(0),
@@ -172,6 +173,7 @@ std::vector<Net*> GlobalRouter::initFastRoute(int min_routing_layer,
   }
 
   fastroute_->setVerbose(verbose_);
+  fastroute_->setNumThreads(num_threads_);
   fastroute_->setOverflowIterations(overflow_iterations_);
   fastroute_->setCongestionReportIterStep(congestion_report_iter_step_);
 
@@ -1358,6 +1360,11 @@ void GlobalRouter::setVerbose(const bool v)
   verbose_ = v;
 }
 
+void GlobalRouter::setNumThreads(int threads)
+{
+  num_threads_ = threads;
+}
+
 void GlobalRouter::setOverflowIterations(int iterations)
 {
   overflow_iterations_ = iterations;
@@ -2791,6 +2798,7 @@ void GlobalRouter::removeNet(odb::dbNet* db_net)
   db_net_map_.erase(db_net);
   dirty_nets_.erase(db_net);
   routes_.erase(db_net);
+  fastroute_->removeNet(db_net);
 }
 
 Net* GlobalRouter::getNet(odb::dbNet* db_net)
@@ -3880,9 +3888,9 @@ IncrementalGRoute::IncrementalGRoute(GlobalRouter* groute, odb::dbBlock* block)
   db_cbk_.addOwner(block);
 }
 
-void IncrementalGRoute::updateRoutes()
+std::vector<odb::dbNet*> IncrementalGRoute::updateRoutes()
 {
-  groute_->updateDirtyRoutes();
+  return groute_->updateDirtyRoutes();
 }
 
 IncrementalGRoute::~IncrementalGRoute()
@@ -3908,8 +3916,11 @@ void GlobalRouter::addDirtyNet(odb::dbNet* net)
   dirty_nets_.insert(net);
 }
 
-void GlobalRouter::updateDirtyRoutes()
+std::vector<odb::dbNet*> GlobalRouter::updateDirtyRoutes()
 {
+  // Nets whose routes changed, including congested neighbors ripped up
+  // to make room for the dirty nets.
+  std::set<odb::dbNet*> rerouted_nets;
   if (!dirty_nets_.empty()) {
     fastroute_->setVerbose(false);
     if (verbose_)
@@ -3924,7 +3935,7 @@ void GlobalRouter::updateDirtyRoutes()
     updateDirtyNets(dirty_nets);
 
     if (dirty_nets.empty()) {
-      return;
+      return {};
     }
 
     initFastRouteIncr(dirty_nets);
@@ -3932,6 +3943,9 @@ void GlobalRouter::updateDirtyRoutes()
     NetRouteMap new_route
         = findRouting(dirty_nets, min_routing_layer_, max_routing_layer_);
     mergeResults(new_route);
+    for (const auto& [db_net, route] : new_route) {
+      rerouted_nets.insert(db_net);
+    }
 
     bool reroutingOverflow = true;
     if (fastroute_->has2Doverflow() && !allow_congestion_) {
@@ -3958,6 +3972,9 @@ void GlobalRouter::updateDirtyRoutes()
         NetRouteMap new_route
             = findRouting(dirty_nets, min_routing_layer_, max_routing_layer_);
         mergeResults(new_route);
+        for (const auto& [db_net, route] : new_route) {
+          rerouted_nets.insert(db_net);
+        }
         add_max--;
       }
       if (fastroute_->has2Doverflow()) {
@@ -3967,7 +3984,10 @@ void GlobalRouter::updateDirtyRoutes()
                        "heatmap in the GUI.");
       }
     }
+    debugPrint(
+        logger_, GRT, "incr", 1, "{} rerouted nets.", rerouted_nets.size());
   }
+  return {rerouted_nets.begin(), rerouted_nets.end()};
 }
 
 void GlobalRouter::initFastRouteIncr(std::vector<Net*>& nets)
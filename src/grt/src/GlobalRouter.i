@@ -113,6 +113,12 @@ set_verbose(bool v)
   getGlobalRouter()->setVerbose(v);
 }
 
+void
+set_num_threads(int threads)
+{
+  getGlobalRouter()->setNumThreads(threads);
+}
+
 void
 set_overflow_iterations(int iterations)
 {
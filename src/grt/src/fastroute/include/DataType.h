@@ -86,6 +86,8 @@ struct FrNet  // A Net is a set of connected MazePoints
 {
   bool isClock() const { return is_clock_; }
   bool isRouted() const { return is_routed_; }
+  // The net was removed from the design; its slot is kept for the ids.
+  bool isRemoved() const { return is_removed_; }
   bool isCritical() { return is_critical_; }
   float getSlack() const { return slack_; }
   odb::dbNet* getDbNet() const { return db_net_; }
@@ -113,6 +115,7 @@ struct FrNet  // A Net is a set of connected MazePoints
              float slack,
              std::vector<int>* edge_cost_per_layer);
   void setIsRouted(bool is_routed) { is_routed_ = is_routed; }
+  void setIsRemoved(bool is_removed) { is_removed_ = is_removed; }
   void setMaxLayer(int max_layer) { max_layer_ = max_layer; }
   void setMinLayer(int min_layer) { min_layer_ = min_layer; }
   void setSlack(float slack) { slack_ = slack; }
@@ -133,6 +136,7 @@ struct FrNet  // A Net is a set of connected MazePoints
   // Non-null when an NDR has been applied to the net.
   std::unique_ptr<std::vector<int>> edge_cost_per_layer_;
   bool is_routed_ = false;
+  bool is_removed_ = false;
 };
 
 struct Edge  // An Edge is the routing track holder between two adjacent
@@ -46,6 +46,7 @@
 
 #include "AbstractMakeWireParasitics.h"
 #include "DataType.h"
+#include "MazeHeap.h"
 #include "grt/GRoute.h"
 #include "odb/geom.h"
 #include "stt/SteinerTreeBuilder.h"
@@ -115,6 +116,8 @@ class FastRouteCore
                 int max_layer,
                 float slack,
                 std::vector<int>* edge_cost_per_layer);
+  // Release the routing resources used by a net that no longer exists.
+  void removeNet(odb::dbNet* db_net);
   void initEdges();
   void setNumAdjustments(int nAdjustements);
   void addAdjustment(int x1,
@@ -165,6 +168,7 @@ class FastRouteCore
   void incrementEdge3DUsage(int x1, int y1, int x2, int y2, int layer);
   void setMaxNetDegree(int);
   void setVerbose(bool v);
+  void setNumThreads(int threads);
   void setUpdateSlack(int u);
   void setMakeWireParasiticsBuilder(AbstractMakeWireParasitics* builder);
   void setOverflowIterations(int iterations);
@@ -208,6 +212,47 @@ class FastRouteCore
   }
 
  private:
+  // Arguments of mazeRouteMSMD shared by all the nets it routes.
+  struct MazeRouteParams
+  {
+    int iter;
+    int expand;
+    float cost_height;
+    int ripup_threshold;
+    int maze_edge_threshold;
+    int cost_type;
+    float logis_cof;
+    int via;
+    int slope;
+    int L;
+    float slack_th;
+  };
+
+  // Scratch data for maze routing one net at a time; one per thread.
+  struct MazeWorkspace
+  {
+    MazeWorkspace(int y_grid, int x_grid, int y_range, int x_range);
+
+    multi_array<float, 2> d1;
+    multi_array<float, 2> d2;
+    MazeHeap<float> src_heap;
+    std::vector<float*> dest_heap;
+    std::vector<bool> pop_heap2;
+    std::vector<OrderNetEdge> net_eo;
+    // grid edges that got usage, merged into h/v_used_ggrid_
+    std::vector<std::pair<int, int>> h_used;
+    std::vector<std::pair<int, int>> v_used;
+    // last region enlargement used, -1 if none
+    int enlarge;
+  };
+
+  enum class MazeNetStatus
+  {
+    kDone,
+    kRetry,        // the tree must be rebuilt and the net routed again
+    kOutOfBounds,  // the next edge needs grid outside the given bounds
+  };
+
   int getEdgeCapacity(FrNet* net, int x1, int y1, EdgeDirection direction);
   void getNetId(odb::dbNet* db_net, int& net_id, bool& exists);
   void clearNetRoute(const int netID);
@@ -232,6 +277,25 @@ class FastRouteCore
                      const int slope,
                      const int L,
                      float& slack_th);
+  void mazeRouteNetBatches(const std::vector<int>& net_ids,
+                           const MazeRouteParams& params);
+  void mazeRouteNetSerial(int netID,
+                          int edge_rec,
+                          const MazeRouteParams& params,
+                          MazeWorkspace& ws);
+  MazeNetStatus mazeRouteNet(int netID,
+                             int& edgeREC,
+                             const MazeRouteParams& params,
+                             const odb::Rect* bounds,
+                             MazeWorkspace& ws);
+  odb::Rect mazeNetBounds(int netID, int expand) const;
+  // Index of a grid in the maze distance arrays.
+  int mazeIndex(int y, int x) const { return y * x_range_ + x; }
+  int mazeIndex3D(int l, int y, int x) const
+  {
+    return l * grid_hv_ + y * x_range_ + x;
+  }
+  void commitUsedGrids(MazeWorkspace& ws);
   void convertToMazeroute();
   void updateCongestionHistory(const int upType, bool stopDEC, int& max_adj);
   int getOverflow2D(int* maxOverflow);
@@ -268,7 +332,7 @@ class FastRouteCore
   void convertToMazerouteNet(const int netID);
   void setupHeap(const int netID,
                  const int edgeID,
-                 std::vector<float*>& src_heap,
+                 MazeHeap<float>& src_heap,
                  std::vector<float*>& dest_heap,
                  multi_array<float, 2>& d1,
                  multi_array<float, 2>& d2,
@@ -315,7 +379,7 @@ class FastRouteCore
                             int layerOrientation);
   void setupHeap3D(int netID,
                    int edgeID,
-                   std::vector<int*>& src_heap_3D,
+                   MazeHeap<int>& src_heap_3D,
                    std::vector<int*>& dest_heap_3D,
                    multi_array<Direction, 3>& directions_3D,
                    multi_array<int, 3>& corr_edge_3D,
@@ -466,7 +530,7 @@ class FastRouteCore
   float CalculatePartialSlack();
   bool checkRoute2DTree(int netID);
   void removeLoops();
-  void netedgeOrderDec(int netID);
+  void netedgeOrderDec(int netID, std::vector<OrderNetEdge>& net_eo);
   void printTree2D(int netID);
   void printEdge2D(int netID, int edgeID);
   void printEdge3D(int netID, int edgeID);
@@ -526,6 +590,7 @@ class FastRouteCore
   bool has_2D_overflow_;
   int grid_hv_;
   bool verbose_;
+  int num_threads_;
   int update_slack_;
   int via_cost_;
   int mazeedge_threshold_;
@@ -551,7 +616,6 @@ class FastRouteCore
 
   std::vector<FrNet*> nets_;
   std::unordered_map<odb::dbNet*, int> db_net_id_map_;  // db net -> net id
-  std::vector<OrderNetEdge> net_eo_;
   std::vector<std::vector<int>>
       gxs_;  // the copy of xs for nets, used for second FLUTE
   std::vector<std::vector<int>>
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+// this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+// this list of conditions and the following disclaimer in the documentation
+// and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its contributors
+// may be used to endorse or promote products derived from this software
+// without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <vector>
+
+namespace grt {
+
+// Binary min-heap of grid indices used by the maze routers.  The keys are
+// kept next to the indices so sifting doesn't chase pointers into the
+// distance arrays, and the heap position of each index is tracked so a
+// decreased key is found without scanning the heap.  Sifting follows the
+// same steps as the pointer heap it replaces, so entries with equal keys
+// pop in the same order and routes are unchanged.
+template <typename Key>
+class MazeHeap
+{
+ public:
+  // Indices are in [0, size).
+  void init(int size)
+  {
+    heap_.clear();
+    pos_.assign(size, -1);
+  }
+
+  void clear()
+  {
+    for (const Entry& entry : heap_) {
+      pos_[entry.index] = -1;
+    }
+    heap_.clear();
+  }
+
+  bool empty() const { return heap_.empty(); }
+  int size() const { return heap_.size(); }
+
+  // Index with the smallest key.
+  int top() const { return heap_[0].index; }
+
+  void push(int index, Key key)
+  {
+    heap_.push_back({key, index});
+    siftUp(heap_.size() - 1);
+  }
+
+  // The key of index went down to key.
+  void decrease(int index, Key key)
+  {
+    const int i = pos_[index];
+    if (i < 0) {
+      push(index, key);
+      return;
+    }
+    heap_[i].key = key;
+    siftUp(i);
+  }
+
+  void pop()
+  {
+    pos_[heap_[0].index] = -1;
+    const Entry last = heap_.back();
+    heap_.pop_back();
+    if (!heap_.empty()) {
+      siftDown(last);
+    }
+  }
+
+ private:
+  struct Entry
+  {
+    Key key;
+    int index;
+  };
+
+  static int parent(int i) { return (i - 1) / 2; }
+  static int left(int i) { return 2 * i + 1; }
+  static int right(int i) { return 2 * i + 2; }
+
+  void place(int i, const Entry& entry)
+  {
+    heap_[i] = entry;
+    pos_[entry.index] = i;
+  }
+
+  void siftUp(int i)
+  {
+    const Entry entry = heap_[i];
+    while (i > 0 && heap_[parent(i)].key > entry.key) {
+      place(i, heap_[parent(i)]);
+      i = parent(i);
+    }
+    place(i, entry);
+  }
+
+  // Sifts entry down from the root.
+  void siftDown(const Entry& entry)
+  {
+    const int heap_size = heap_.size();
+    int i = 0;
+    while (true) {
+      const int l = left(i);
+      const int r = right(i);
+      int smallest;
+      if (l < heap_size && heap_[l].key < entry.key) {
+        smallest = l;
+        if (r < heap_size && heap_[r].key < heap_[l].key) {
+          smallest = r;
+        }
+      } else {
+        smallest = i;
+        if (r < heap_size && heap_[r].key < entry.key) {
+          smallest = r;
+        }
+      }
+      if (smallest == i) {
+        break;
+      }
+      place(i, heap_[smallest]);
+      i = smallest;
+    }
+    place(i, entry);
+  }
+
+  std::vector<Entry> heap_;
+  std::vector<int> pos_;
+};
+
+}  // namespace grt
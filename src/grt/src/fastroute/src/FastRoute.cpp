@@ -74,6 +74,7 @@ FastRouteCore::FastRouteCore(odb::dbDatabase* db,
       has_2D_overflow_(false),
       grid_hv_(0),
       verbose_(false),
+      num_threads_(1),
       update_slack_(0),
       via_cost_(0),
       mazeedge_threshold_(0),
@@ -120,8 +121,6 @@ void FastRouteCore::clear()
   parent_x3_.resize(boost::extents[0][0]);
   parent_y3_.resize(boost::extents[0][0]);
 
-  net_eo_.clear();
-
   xcor_.clear();
   ycor_.clear();
   dcor_.clear();
@@ -274,6 +273,28 @@ FrNet* FastRouteCore::addNet(odb::dbNet* db_net,
   return net;
 }
 
+void FastRouteCore::removeNet(odb::dbNet* db_net)
+{
+  int netID;
+  bool exists;
+  getNetId(db_net, netID, exists);
+  if (!exists) {
+    return;
+  }
+  clearNetRoute(netID);
+  sttrees_[netID].num_nodes = 0;
+  sttrees_[netID].num_terminals = 0;
+  seglist_[netID].clear();
+  db_net_id_map_.erase(db_net);
+  // Net ids index the per-net vectors, so the slot is kept as an empty net.
+  // It is flagged routed, which the passes over unrouted nets skip; the
+  // passes over all nets skip it through isRemoved().
+  FrNet* net = nets_[netID];
+  net->reset(nullptr, false, 0, 0, 0, 0, 0, nullptr);
+  net->setIsRouted(true);
+  net->setIsRemoved(true);
+}
+
 void FastRouteCore::getNetId(odb::dbNet* db_net, int& net_id, bool& exists)
 {
   auto itr = db_net_id_map_.find(db_net);
@@ -699,6 +720,9 @@ NetRouteMap FastRouteCore::getPlanarRoutes()
 
   for (int netID = 0; netID < netCount(); netID++) {
     auto fr_net = nets_[netID];
+    if (fr_net->isRemoved()) {
+      continue;
+    }
     odb::dbNet* db_net = fr_net->getDbNet();
     GRoute& route = routes[db_net];
     std::unordered_set<GSegment, GSegmentHash> net_segs;
@@ -835,7 +859,6 @@ NetRouteMap FastRouteCore::run()
   xcor_.resize(max_degree2);
   ycor_.resize(max_degree2);
   dcor_.resize(max_degree2);
-  net_eo_.reserve(max_degree2);
 
   int THRESH_M = 20;
   const int ENLARGE = 15;  // 5
@@ -1257,7 +1280,6 @@ NetRouteMap FastRouteCore::run()
   }
 
   NetRouteMap routes = getRoutes();
-  net_eo_.clear();
   return routes;
 }
 
@@ -1266,6 +1288,11 @@ void FastRouteCore::setVerbose(bool v)
   verbose_ = v;
 }
 
+void FastRouteCore::setNumThreads(int threads)
+{
+  num_threads_ = threads;
+}
+
 void FastRouteCore::setUpdateSlack(int u)
 {
   update_slack_ = u;
@@ -1460,6 +1487,7 @@ void FrNet::reset(odb::dbNet* db_net,
 {
   db_net_ = db_net;
   is_routed_ = false;
+  is_removed_ = false;
   is_critical_ = false;
   is_clock_ = is_clock;
   driver_idx_ = driver_idx;
@@ -35,6 +35,7 @@
 #include "DataType.h"
 #include "FastRoute.h"
 #include "utl/Logger.h"
+#include "utl/timer.h"
 
 namespace grt {
 
@@ -46,75 +47,9 @@ struct parent3D
   int x, y;
 };
 
-static int parent_index(int i)
-{
-  return (i - 1) / 2;
-}
-
-static int left_index(int i)
-{
-  return 2 * i + 1;
-}
-
-static int right_index(int i)
-{
-  return 2 * i + 2;
-}
-
-// non recursive version of heapify-
-static void heapify3D(std::vector<int*>& array)
-{
-  bool stop = false;
-  const int heapSize = array.size();
-  int i = 0;
-
-  int* tmp = array[i];
-  do {
-    const int l = left_index(i);
-    const int r = right_index(i);
-
-    int smallest;
-    if (l < heapSize && *(array[l]) < *tmp) {
-      smallest = l;
-      if (r < heapSize && *(array[r]) < *(array[l]))
-        smallest = r;
-    } else {
-      smallest = i;
-      if (r < heapSize && *(array[r]) < *tmp)
-        smallest = r;
-    }
-    if (smallest != i) {
-      array[i] = array[smallest];
-      i = smallest;
-    } else {
-      array[i] = tmp;
-      stop = true;
-    }
-  } while (!stop);
-}
-
-static void updateHeap3D(std::vector<int*>& array, int i)
-{
-  int* tmpi = array[i];
-  while (i > 0 && *(array[parent_index(i)]) > *tmpi) {
-    const int parent = parent_index(i);
-    array[i] = array[parent];
-    i = parent;
-  }
-  array[i] = tmpi;
-}
-
-// extract the entry with minimum distance from Priority queue
-static void removeMin3D(std::vector<int*>& array)
-{
-  array[0] = array.back();
-  heapify3D(array);
-  array.pop_back();
-}
-
 void FastRouteCore::setupHeap3D(int netID,
                                 int edgeID,
-                                std::vector<int*>& src_heap_3D,
+                                MazeHeap<int>& src_heap_3D,
                                 std::vector<int*>& dest_heap_3D,
                                 multi_array<Direction, 3>& directions_3D,
                                 multi_array<int, 3>& corr_edge_3D,
@@ -143,7 +78,7 @@ void FastRouteCore::setupHeap3D(int netID,
   if (num_terminals == 2) {  // 2-pin net
     d1_3D[0][y1][x1] = 0;
     directions_3D[0][y1][x1] = Direction::Origin;
-    src_heap_3D.push_back(&d1_3D[0][y1][x1]);
+    src_heap_3D.push(mazeIndex3D(0, y1, x1), 0);
     d2_3D[0][y2][x2] = 0;
     directions_3D[0][y2][x2] = Direction::Origin;
     dest_heap_3D.push_back(&d2_3D[0][y2][x2]);
@@ -166,7 +101,7 @@ void FastRouteCore::setupHeap3D(int netID,
 
       for (int l = treenodes[nt].botL; l <= treenodes[nt].topL; l++) {
         d1_3D[l][y1][x1] = 0;
-        src_heap_3D.push_back(&d1_3D[l][y1][x1]);
+        src_heap_3D.push(mazeIndex3D(l, y1, x1), 0);
         directions_3D[l][y1][x1] = Direction::Origin;
         heapVisited[n1] = true;
       }
@@ -180,7 +115,7 @@ void FastRouteCore::setupHeap3D(int netID,
       for (int l = treenodes[nt].botL; l <= treenodes[nt].topL; l++) {
         d1_3D[l][y1][x1] = 0;
         directions_3D[l][y1][x1] = Direction::Origin;
-        src_heap_3D.push_back(&d1_3D[l][y1][x1]);
+        src_heap_3D.push(mazeIndex3D(l, y1, x1), 0);
         heapVisited[n1] = true;
       }
 
@@ -218,7 +153,7 @@ void FastRouteCore::setupHeap3D(int netID,
               for (int l = treenodes[nt].botL; l <= treenodes[nt].topL; l++) {
                 d1_3D[l][nbrY][nbrX] = 0;
                 directions_3D[l][nbrY][nbrX] = Direction::Origin;
-                src_heap_3D.push_back(&d1_3D[l][nbrY][nbrX]);
+                src_heap_3D.push(mazeIndex3D(l, nbrY, nbrX), 0);
                 corr_edge_3D[l][nbrY][nbrX] = edge;
               }
             }
@@ -235,7 +170,7 @@ void FastRouteCore::setupHeap3D(int netID,
 
                 if (in_region_[y_grid][x_grid]) {
                   d1_3D[l_grid][y_grid][x_grid] = 0;
-                  src_heap_3D.push_back(&d1_3D[l_grid][y_grid][x_grid]);
+                  src_heap_3D.push(mazeIndex3D(l_grid, y_grid, x_grid), 0);
                   directions_3D[l_grid][y_grid][x_grid] = Direction::Origin;
                   corr_edge_3D[l_grid][y_grid][x_grid] = edge;
                 }
@@ -865,7 +800,6 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
 
   // allocate memory for priority queue
   total_size = static_cast<int64>(y_grid_) * x_grid_ * num_layers_;
-  static std::vector<int*> src_heap_3D(total_size);
   static std::vector<int*> dest_heap_3D(total_size);
 
   for (int i = 0; i < y_grid_; i++) {
@@ -881,12 +815,19 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
   static multi_array<int, 3> d2_3D(
       boost::extents[num_layers_][y_range_][x_range_]);
 
+  MazeHeap<int> src_heap_3D;
+  src_heap_3D.init(d1_3D.num_elements());
+
+  utl::Timer timer;
+  int net_cnt = 0;
+
   for (int orderIndex = 0; orderIndex < endIND; orderIndex++) {
     const int netID = tree_order_pv_[orderIndex].treeIndex;
     FrNet* net = nets_[netID];
 
     if (net->isRouted())
       continue;
+    net_cnt++;
 
     int enlarge = expand;
     const int num_terminals = sttrees_[netID].num_terminals;
@@ -958,7 +899,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                   regionY2);
 
       // while loop to find shortest path
-      int ind1 = (src_heap_3D[0] - &d1_3D[0][0][0]);
+      int ind1 = src_heap_3D.top();
 
       for (int i = 0; i < dest_heap_3D.size(); i++)
         pop_heap2_3D[dest_heap_3D[i] - &d2_3D[0][0][0]] = true;
@@ -973,7 +914,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
         const int remd = ind1 % (grid_hv_);
         const int curX = remd % x_range_;
         const int curY = remd / x_range_;
-        removeMin3D(src_heap_3D);
+        src_heap_3D.pop();
 
         const bool Horizontal = (((curL % 2) - layerOrientation) == 0);
 
@@ -995,8 +936,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D[curL][curY][tmpX] = Direction::West;
-                src_heap_3D.push_back(&d1_3D[curL][curY][tmpX]);
-                updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+                src_heap_3D.push(mazeIndex3D(curL, curY, tmpX),
+                                 d1_3D[curL][curY][tmpX]);
               } else if (d1_3D[curL][curY][tmpX]
                          > tmp)  // left neighbor been put into src_heap_3D
                                  // but needs update
@@ -1006,11 +947,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D[curL][curY][tmpX] = Direction::West;
-                const int* dtmp = &d1_3D[curL][curY][tmpX];
-                int ind = 0;
-                while (src_heap_3D[ind] != dtmp)
-                  ind++;
-                updateHeap3D(src_heap_3D, ind);
+                src_heap_3D.decrease(mazeIndex3D(curL, curY, tmpX),
+                                     d1_3D[curL][curY][tmpX]);
               }
             }
           }
@@ -1032,8 +970,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D[curL][curY][tmpX] = Direction::East;
-                src_heap_3D.push_back(&d1_3D[curL][curY][tmpX]);
-                updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+                src_heap_3D.push(mazeIndex3D(curL, curY, tmpX),
+                                 d1_3D[curL][curY][tmpX]);
               } else if (d1_3D[curL][curY][tmpX]
                          > tmp)  // right neighbor been put into src_heap_3D
                                  // but needs update
@@ -1043,11 +981,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][curY][tmpX].x = curX;
                 pr_3D_[curL][curY][tmpX].y = curY;
                 directions_3D[curL][curY][tmpX] = Direction::East;
-                const int* dtmp = &d1_3D[curL][curY][tmpX];
-                int ind = 0;
-                while (src_heap_3D[ind] != dtmp)
-                  ind++;
-                updateHeap3D(src_heap_3D, ind);
+                src_heap_3D.decrease(mazeIndex3D(curL, curY, tmpX),
+                                     d1_3D[curL][curY][tmpX]);
               }
             }
           }
@@ -1069,8 +1004,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D[curL][tmpY][curX] = Direction::North;
-                src_heap_3D.push_back(&d1_3D[curL][tmpY][curX]);
-                updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+                src_heap_3D.push(mazeIndex3D(curL, tmpY, curX),
+                                 d1_3D[curL][tmpY][curX]);
               } else if (d1_3D[curL][tmpY][curX]
                          > tmp)  // bottom neighbor been put into
                                  // src_heap_3D but needs update
@@ -1080,11 +1015,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D[curL][tmpY][curX] = Direction::North;
-                const int* dtmp = &d1_3D[curL][tmpY][curX];
-                int ind = 0;
-                while (src_heap_3D[ind] != dtmp)
-                  ind++;
-                updateHeap3D(src_heap_3D, ind);
+                src_heap_3D.decrease(mazeIndex3D(curL, tmpY, curX),
+                                     d1_3D[curL][tmpY][curX]);
               }
             }
           }
@@ -1104,8 +1036,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D[curL][tmpY][curX] = Direction::South;
-                src_heap_3D.push_back(&d1_3D[curL][tmpY][curX]);
-                updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+                src_heap_3D.push(mazeIndex3D(curL, tmpY, curX),
+                                 d1_3D[curL][tmpY][curX]);
               } else if (d1_3D[curL][tmpY][curX]
                          > tmp)  // top neighbor been put into src_heap_3D
                                  // but needs update
@@ -1115,11 +1047,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                 pr_3D_[curL][tmpY][curX].x = curX;
                 pr_3D_[curL][tmpY][curX].y = curY;
                 directions_3D[curL][tmpY][curX] = Direction::South;
-                const int* dtmp = &d1_3D[curL][tmpY][curX];
-                int ind = 0;
-                while (src_heap_3D[ind] != dtmp)
-                  ind++;
-                updateHeap3D(src_heap_3D, ind);
+                src_heap_3D.decrease(mazeIndex3D(curL, tmpY, curX),
+                                     d1_3D[curL][tmpY][curX]);
               }
             }
           }
@@ -1138,8 +1067,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D[tmpL][curY][curX] = Direction::Down;
-            src_heap_3D.push_back(&d1_3D[tmpL][curY][curX]);
-            updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+            src_heap_3D.push(mazeIndex3D(tmpL, curY, curX),
+                             d1_3D[tmpL][curY][curX]);
           } else if (d1_3D[tmpL][curY][curX]
                      > tmp)  // bottom neighbor been put into src_heap_3D
                              // but needs update
@@ -1149,11 +1078,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D[tmpL][curY][curX] = Direction::Down;
-            const int* dtmp = &d1_3D[tmpL][curY][curX];
-            int ind = 0;
-            while (src_heap_3D[ind] != dtmp)
-              ind++;
-            updateHeap3D(src_heap_3D, ind);
+            src_heap_3D.decrease(mazeIndex3D(tmpL, curY, curX),
+                                 d1_3D[tmpL][curY][curX]);
           }
         }
 
@@ -1170,8 +1096,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D[tmpL][curY][curX] = Direction::Up;
-            src_heap_3D.push_back(&d1_3D[tmpL][curY][curX]);
-            updateHeap3D(src_heap_3D, src_heap_3D.size() - 1);
+            src_heap_3D.push(mazeIndex3D(tmpL, curY, curX),
+                             d1_3D[tmpL][curY][curX]);
           } else if (d1_3D[tmpL][curY][curX]
                      > tmp)  // bottom neighbor been put into src_heap_3D
                              // but needs update
@@ -1181,11 +1107,8 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
             pr_3D_[tmpL][curY][curX].x = curX;
             pr_3D_[tmpL][curY][curX].y = curY;
             directions_3D[tmpL][curY][curX] = Direction::Up;
-            const int* dtmp = &d1_3D[tmpL][curY][curX];
-            int ind = 0;
-            while (src_heap_3D[ind] != dtmp)
-              ind++;
-            updateHeap3D(src_heap_3D, ind);
+            src_heap_3D.decrease(mazeIndex3D(tmpL, curY, curX),
+                                 d1_3D[tmpL][curY][curX]);
           }
         }
 
@@ -1196,7 +1119,7 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
                          nets_[netID]->getName());
         }
         // update ind1 for next loop
-        ind1 = (src_heap_3D[0] - &d1_3D[0][0][0]);
+        ind1 = src_heap_3D.top();
       }  // while loop
 
       for (int i = 0; i < dest_heap_3D.size(); i++)
@@ -1709,6 +1632,15 @@ void FastRouteCore::mazeRouteMSMDOrder3D(int expand,
       }  // eunmerating edges
     }
   }
+
+  debugPrint(logger_,
+             GRT,
+             "mazeRoute",
+             1,
+             "3D maze routed {} nets in {:.3f}s ({:.1f}us per net).",
+             net_cnt,
+             timer.elapsed(),
+             net_cnt > 0 ? timer.elapsed() * 1e6 / net_cnt : 0.0);
 }
 
 }  // namespace grt
@@ -0,0 +1,37 @@
+# Batched maze routing must give the same guides and usage for any thread
+# count above one.  A single thread keeps the serial net order.
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "gcd.def"
+
+set_global_routing_layer_adjustment metal2 0.9
+set_global_routing_layer_adjustment metal3 0.9
+set_global_routing_layer_adjustment metal4-metal6 0.9
+set_global_routing_layer_adjustment metal7-metal10 1.0
+
+set_routing_layers -signal metal2-metal10
+
+set files {}
+foreach threads {2 4} {
+  set_thread_count $threads
+  set guide_file [make_result_file maze_threads_$threads.guide]
+  set report_file [make_result_file maze_threads_$threads.rpt]
+  file delete -force $report_file
+  global_route -allow_congestion -congestion_report_file $report_file
+  write_guides $guide_file
+  lappend files [list $guide_file $report_file]
+}
+
+lassign $files expected threaded
+foreach expected_file $expected threaded_file $threaded {
+  if { [file exists $expected_file] != [file exists $threaded_file] } {
+    puts "fail: $threaded_file does not match $expected_file"
+    exit 1
+  }
+  if { [file exists $expected_file] \
+         && [diff_files $expected_file $threaded_file] != 0 } {
+    puts "fail: $threaded_file differs from $expected_file"
+    exit 1
+  }
+}
+puts "pass"
@@ -59,3 +59,7 @@ record_tests {
   tracks3
   upper_layer_net
 }
+record_pass_fail_tests {
+  maze_threads
+  remove_net_incremental
+}
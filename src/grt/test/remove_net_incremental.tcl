@@ -0,0 +1,53 @@
+# Destroying a net while incremental routing is active must leave the
+# remaining nets routable and reportable.
+source "helpers.tcl"
+read_lef "Nangate45/Nangate45.lef"
+read_def "gcd.def"
+
+set_global_routing_layer_adjustment metal2-metal10 0.5
+set_routing_layers -signal metal2-metal10
+
+global_route
+global_route -start_incremental
+
+set block [ord::get_db_block]
+set removed ""
+foreach net [$block getNets] {
+  if { ![$net isSpecial] && [llength [$net getBTerms]] == 0 \
+         && [llength [$net getITerms]] > 1 } {
+    set removed [$net getName]
+    odb::dbNet_destroy $net
+    break
+  }
+}
+if { $removed == "" } {
+  puts "fail: no net to remove"
+  exit 1
+}
+
+# Dirty a surviving net so the incremental pass has something to reroute.
+foreach inst [$block getInsts] {
+  if { [$inst getPlacementStatus] == "PLACED" } {
+    lassign [$inst getOrigin] x y
+    $inst setOrigin [expr $x + 380] $y
+    break
+  }
+}
+
+set guide_file [make_result_file remove_net_incremental.guide]
+set report_file [make_result_file remove_net_incremental.rpt]
+file delete -force $report_file
+global_route -end_incremental -allow_congestion \
+  -congestion_report_file $report_file
+write_guides $guide_file
+
+set stream [open $guide_file r]
+while { [gets $stream line] >= 0 } {
+  if { $line == $removed } {
+    puts "fail: guides written for removed net $removed"
+    exit 1
+  }
+}
+close $stream
+
+puts "pass"
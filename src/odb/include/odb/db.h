@@ -92,6 +92,7 @@ class dbCapNode;
 class dbRSeg;
 class dbCCSeg;
 class dbBlockSearch;
+class dbSpatialIndex;
 class dbRow;
 class dbFill;
 class dbTechAntennaPinModel;
@@ -374,6 +375,20 @@ class dbDatabase : public dbObject
   ///
   void read(std::ifstream& f);
 
+  ///
+  /// Read a database from this file, leaving the wires and parasitics of
+  /// each block on disk until they are first accessed.  The file must not
+  /// be modified until then; see loadLazySections().
+  /// WARNING: This function destroys the data currently in the database.
+  ///
+  void readLazy(const char* file_name);
+
+  ///
+  /// Read any sections skipped by readLazy().  Call this before overwriting
+  /// the file the database was read from.
+  ///
+  void loadLazySections();
+
   ///
   /// Write a database to this stream.
   /// Throws ZIOError..
@@ -413,7 +428,8 @@ class dbDatabase : public dbObject
   ///
   /// Begin collecting netlist changes on specified block.
   ///
-  /// NOTE: Eco changes can not be nested at this time.
+  /// NOTE: Eco changes can not be nested at this time, nor collected while
+  /// a transaction is open.
   ///
   static void beginEco(dbBlock* block);
 
@@ -444,6 +460,51 @@ class dbDatabase : public dbObject
   ///
   static void commitEco(dbBlock* block);
 
+  ///
+  /// Transactions reuse the eco journal to make netlist and placement
+  /// changes on a block revertible. Changes made between beginTransaction
+  /// and commitTransaction can be rolled back as a whole, or back to a
+  /// savepoint taken in between. Deleted instances, nets and bterms are
+  /// recreated with their original ids, so handles held from before the
+  /// transaction remain valid after a rollback.
+  ///
+  /// Only instance, net, bterm and iterm creation, deletion, connection,
+  /// renames, master swaps, placement and flag changes can be rolled back;
+  /// any other journaled change (e.g. parasitics) makes the rollback fail
+  /// before the block is touched. Wires, bpins, properties, groups and
+  /// halos of deleted objects are not restored.
+  ///
+  /// NOTE: A transaction can not be started while an eco is being collected,
+  /// nor an eco while a transaction is open.
+  ///
+
+  ///
+  /// Begin journaling changes on the specified block.
+  ///
+  static void beginTransaction(dbBlock* block);
+
+  ///
+  /// Returns a savepoint marking the current state of the transaction.
+  ///
+  static uint transactionSavepoint(dbBlock* block);
+
+  ///
+  /// Revert the changes made since the savepoint, or since the transaction
+  /// began if no savepoint is given. The transaction remains open.
+  ///
+  /// If a deleted object can not be recreated with its original id, which
+  /// only happens when the block was changed without journaling, the
+  /// rollback stops with an error. The block is then left as it was just
+  /// after that delete, and the transaction still holds the changes up to
+  /// it.
+  ///
+  static void rollbackTransaction(dbBlock* block, uint savepoint = 0);
+
+  ///
+  /// Keep the changes and stop journaling.
+  ///
+  static void commitTransaction(dbBlock* block);
+
   ///
   /// links to utl::Logger
   ///
@@ -1347,6 +1408,13 @@ class dbBlock : public dbObject
   ///
   dbBlockSearch* getSearchDb();
 
+  ///
+  /// Get the spatial index of this block's placed instances and routing
+  /// shapes, building it on first use.  It is shared by all callers and
+  /// kept up to date as the block is edited.
+  ///
+  dbSpatialIndex* getSpatialIndex();
+
   ///
   /// reset _netSdb
   ///
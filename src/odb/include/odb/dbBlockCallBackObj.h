@@ -108,6 +108,7 @@ class dbBlockCallBackObj
 
   // dbBPin Start
   virtual void inDbBPinCreate(dbBPin*) {}
+  virtual void inDbBPinAddBox(dbBox*) {}
   virtual void inDbBPinDestroy(dbBPin*) {}
   // dbBPin End
 
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+#include <vector>
+
+#include "dbBlockCallBackObj.h"
+#include "geom.h"
+
+namespace odb {
+
+class dbObject;
+class dbTechLayer;
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// dbSpatialIndex - An R-tree index of the placed instances and the
+/// routing shapes of a block.
+///
+/// There is one per block, shared by every tool, made on the first call to
+/// dbBlock::getSpatialIndex().  After the initial build it follows edits to
+/// the block through dbBlockCallBackObj rather than being rebuilt.
+///
+/// The find methods take a shared lock and may be called from many threads
+/// at once.  The callbacks take an exclusive lock.
+///
+///////////////////////////////////////////////////////////////////////////////
+class dbSpatialIndex : public dbBlockCallBackObj
+{
+ public:
+  struct Shape
+  {
+    Rect rect;
+    // The dbWire, dbSBox, dbObstruction or dbBPin the shape belongs to.
+    dbObject* owner;
+  };
+
+  dbSpatialIndex(dbBlock* block);
+  ~dbSpatialIndex() override;
+
+  dbBlock* getBlock() const { return block_; }
+
+  ///
+  /// Append the placed instances whose bbox intersects area.
+  ///
+  void findInsts(const Rect& area, std::vector<dbInst*>& insts) const;
+
+  ///
+  /// Append the shapes on layer that intersect area.  Via shapes are
+  /// indexed by their individual cut and enclosure boxes.
+  ///
+  void findShapes(dbTechLayer* layer,
+                  const Rect& area,
+                  std::vector<Shape>& shapes) const;
+
+  // dbBlockCallBackObj
+  void inDbInstCreate(dbInst* inst) override;
+  void inDbInstCreate(dbInst* inst, dbRegion* region) override;
+  void inDbInstDestroy(dbInst* inst) override;
+  void inDbInstPlacementStatusBefore(dbInst* inst,
+                                     const dbPlacementStatus& status) override;
+  void inDbInstSwapMasterBefore(dbInst* inst, dbMaster* master) override;
+  void inDbInstSwapMasterAfter(dbInst* inst) override;
+  void inDbPreMoveInst(dbInst* inst) override;
+  void inDbPostMoveInst(dbInst* inst) override;
+  void inDbBPinAddBox(dbBox* box) override;
+  void inDbBPinDestroy(dbBPin* pin) override;
+  void inDbObstructionCreate(dbObstruction* obs) override;
+  void inDbObstructionDestroy(dbObstruction* obs) override;
+  void inDbWireDestroy(dbWire* wire) override;
+  void inDbWirePostModify(dbWire* wire) override;
+  void inDbWirePostAttach(dbWire* wire) override;
+  void inDbWirePreDetach(dbWire* wire) override;
+  void inDbWirePreAppend(dbWire* src, dbWire* dst) override;
+  void inDbWirePostAppend(dbWire* src, dbWire* dst) override;
+  void inDbWirePreCopy(dbWire* src, dbWire* dst) override;
+  void inDbWirePostCopy(dbWire* src, dbWire* dst) override;
+  void inDbSWireAddSBox(dbSBox* box) override;
+  void inDbSWireRemoveSBox(dbSBox* box) override;
+  void inDbSWirePreDestroySBoxes(dbSWire* wire) override;
+
+ private:
+  struct Trees;
+
+  void build();
+  void addInst(dbInst* inst);
+  void addBPin(dbBPin* pin);
+  void addBox(dbBox* box, dbObject* owner);
+  void addObstruction(dbObstruction* obs);
+  void addWire(dbWire* wire);
+  void addSBox(dbSBox* box);
+  void add(dbTechLayer* layer, const Rect& rect, dbObject* owner);
+  void remove(dbObject* owner);
+
+  dbBlock* block_;
+  std::unique_ptr<Trees> trees_;
+  mutable std::shared_mutex mutex_;
+};
+
+}  // namespace odb
@@ -36,6 +36,7 @@
 #include <cstring>
 #include <fstream>
 #include <string>
+#include <vector>
 
 #include "ZException.h"
 #include "dbObject.h"
@@ -53,6 +54,14 @@ class dbOStream
   FILE* _f;
   double _lef_area_factor;
   double _lef_dist_factor;
+  // Fields are gathered here and written with one fwrite per buffer rather
+  // than one per field.
+  std::vector<char> _buffer;
+  size_t _buffer_used;
+  // Bytes this stream has handed to fwrite and the file offset it started
+  // at (-1 if _f can't seek).
+  uint64_t _flushed;
+  long _start;
 
   void write_error()
   {
@@ -60,8 +69,30 @@ class dbOStream
                      strerror(ferror(_f)));
   }
 
+  void write(const void* data, size_t size)
+  {
+    if (_buffer_used + size > _buffer.size()) {
+      write_large(data, size);
+      return;
+    }
+    std::memcpy(_buffer.data() + _buffer_used, data, size);
+    _buffer_used += size;
+  }
+  void write_large(const void* data, size_t size);
+
  public:
   dbOStream(_dbDatabase* db, FILE* f);
+  ~dbOStream();
+
+  // Writes out the buffered fields.  Must be called once the stream is
+  // complete so that write errors are reported.
+  void flush();
+
+  // Writes a placeholder for the size in bytes of the section that follows
+  // and returns a mark for endSection(), which fills it in.  The size stays
+  // 0 if _f can't seek.
+  uint64_t beginSection();
+  void endSection(uint64_t mark);
 
   _dbDatabase* getDatabase() { return _db; }
 
@@ -73,100 +104,67 @@ class dbOStream
 
   dbOStream& operator<<(char c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(unsigned char c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(int16_t c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(uint16_t c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(int c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(uint64_t c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(unsigned int c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(int8_t c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(float c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(double c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
   dbOStream& operator<<(long double c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
@@ -177,10 +175,7 @@ class dbOStream
     } else {
       int l = strlen(c) + 1;
       *this << l;
-      int n = fwrite(c, l, 1, _f);
-      if (n != 1) {
-        write_error();
-      }
+      write(c, l);
     }
 
     return *this;
@@ -188,10 +183,7 @@ class dbOStream
 
   dbOStream& operator<<(dbObjectType c)
   {
-    int n = fwrite(&c, sizeof(c), 1, _f);
-    if (n != 1) {
-      write_error();
-    }
+    write(&c, sizeof(c));
     return *this;
   }
 
@@ -235,13 +227,7 @@ class dbOStream
     return *this;
   }
 
-  dbOStream& operator<<(const std::string& s)
-  {
-    char* tmp = strdup(s.c_str());
-    *this << tmp;
-    free((void*) tmp);
-    return *this;
-  }
+  dbOStream& operator<<(const std::string& s) { return *this << s.c_str(); }
 
   double lefarea(int value) { return ((double) value * _lef_area_factor); }
 
@@ -254,9 +240,31 @@ class dbIStream
   _dbDatabase* _db;
   double _lef_area_factor;
   double _lef_dist_factor;
+  // Fields are read from here, refilled with one read per buffer rather
+  // than one per field.  Unread bytes are given back to _f on destruction
+  // so that several streams can read one file in turn.
+  std::vector<char> _buffer;
+  size_t _buffer_pos;
+  size_t _buffer_end;
+
+  void read(void* data, size_t size)
+  {
+    if (_buffer_end - _buffer_pos < size) {
+      read_large(data, size);
+      return;
+    }
+    std::memcpy(data, _buffer.data() + _buffer_pos, size);
+    _buffer_pos += size;
+  }
+  void read_large(void* data, size_t size);
 
  public:
   dbIStream(_dbDatabase* db, std::ifstream& f);
+  ~dbIStream();
+
+  // File offset of the next field.
+  uint64_t tell();
+  void skip(uint64_t size);
 
   _dbDatabase* getDatabase() { return _db; }
 
@@ -270,67 +278,67 @@ class dbIStream
 
   dbIStream& operator>>(char& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(unsigned char& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(int16_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(uint16_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(int& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(uint64_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(unsigned int& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(int8_t& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(float& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(double& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
   dbIStream& operator>>(long double& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
@@ -343,7 +351,7 @@ class dbIStream
       c = nullptr;
     } else {
       c = (char*) malloc(l);
-      _f.read(reinterpret_cast<char*>(c), l);
+      read(c, l);
     }
 
     return *this;
@@ -351,7 +359,7 @@ class dbIStream
 
   dbIStream& operator>>(dbObjectType& c)
   {
-    _f.read(reinterpret_cast<char*>(&c), sizeof(c));
+    read(&c, sizeof(c));
     return *this;
   }
 
@@ -70,6 +70,8 @@ class defin
   void skipBlockWires();
   void skipFillWires();
   void continueOnErrors();
+  /// Build nets on a separate thread while the NETS section is parsed.
+  void useNetBuilderThread();
   void namesAreDBIDs();
   void setAssemblyMode();
   void useBlockName(const char* name);
@@ -65,6 +65,9 @@ class defout
   void setUseMasterIds(bool value);
   void selectNet(dbNet* net);
   void setVersion(Version v);  // default is 5.8
+  // Format components and nets on this many threads; the output is the
+  // same for any thread count.  A def_file ending in .gz is compressed.
+  void setNumThreads(int threads);
 
   bool writeBlock(dbBlock* block, const char* def_file);
 };
@@ -306,6 +306,17 @@ bool dbBTerm::rename(const char* name)
     return false;
   }
 
+  if (block->_journal) {
+    debugPrint(getImpl()->getLogger(),
+               utl::ODB,
+               "DB_ECO",
+               1,
+               "ECO: bterm {}, rename to {}",
+               getId(),
+               name);
+    block->_journal->updateField(this, _dbBTerm::NAME, bterm->_name, name);
+  }
+
   block->_bterm_hash.remove(bterm);
   free((void*) bterm->_name);
   bterm->_name = strdup(name);
@@ -482,6 +493,7 @@ void dbBTerm::disconnect()
       block->_journal->beginAction(dbJournal::DISCONNECT_OBJECT);
       block->_journal->pushParam(dbBTermObj);
       block->_journal->pushParam(bterm->getId());
+      block->_journal->pushParam(net->getId());
       block->_journal->endAction();
     }
 
@@ -653,6 +665,11 @@ dbBTerm* dbBTerm::create(dbNet* net_, const char* name)
                             net->_name);
   }
 
+  _dbBTerm* bterm = block->_bterm_tbl->create();
+  bterm->_name = strdup(name);
+  ZALLOCATED(bterm->_name);
+  block->_bterm_hash.insert(bterm);
+
   if (block->_journal) {
     debugPrint(block->getImpl()->getLogger(),
                utl::ODB,
@@ -663,13 +680,9 @@ dbBTerm* dbBTerm::create(dbNet* net_, const char* name)
     block->_journal->pushParam(dbBTermObj);
     block->_journal->pushParam(net->getId());
     block->_journal->pushParam(name);
+    block->_journal->pushParam(bterm->getOID());
     block->_journal->endAction();
   }
-
-  _dbBTerm* bterm = block->_bterm_tbl->create();
-  bterm->_name = strdup(name);
-  ZALLOCATED(bterm->_name);
-  block->_bterm_hash.insert(bterm);
   for (auto callback : block->_callbacks) {
     callback->inDbBTermCreate((dbBTerm*) bterm);
   }
@@ -720,6 +733,7 @@ void dbBTerm::destroy(dbBTerm* bterm_)
   for (itr = bpins.begin(); itr != bpins.end();) {
     itr = dbBPin::destroy(itr);
   }
+  const uint net_id = bterm->_net;
   if (bterm->_net) {
     bterm->disconnectNet(bterm, block);
   }
@@ -736,6 +750,10 @@ void dbBTerm::destroy(dbBTerm* bterm_)
     block->_journal->beginAction(dbJournal::DELETE_OBJECT);
     block->_journal->pushParam(dbBTermObj);
     block->_journal->pushParam(bterm_->getId());
+    // The remaining params are only used to undo the delete.
+    block->_journal->pushParam(net_id);
+    block->_journal->pushParam(bterm->_name);
+    block->_journal->pushParam(flagsToUInt(bterm));
     block->_journal->endAction();
   }
 
@@ -72,7 +72,8 @@ class _dbBTerm : public _dbObject
  public:
   enum Field  // dbJournalField name
   {
-    FLAGS
+    FLAGS,
+    NAME
   };
   // PERSISTANT-MEMBERS
   _dbBTermFlags _flags;
@@ -109,6 +109,7 @@
 #include "dbSWireItr.h"
 #include "dbSearch.h"
 #include "dbShape.h"
+#include "dbSpatialIndex.h"
 #include "dbTable.h"
 #include "dbTable.hpp"
 #include "dbTech.h"
@@ -370,9 +371,12 @@ _dbBlock::_dbBlock(_dbDatabase* db)
 
   _num_ext_dbs = 1;
   _searchDb = nullptr;
+  _spatial_index = nullptr;
   _extmi = nullptr;
   _journal = nullptr;
   _journal_pending = nullptr;
+  _lazy_wires_pending = false;
+  _lazy_parasitics_pending = false;
 }
 
 _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
@@ -414,6 +418,11 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
       _component_mask_shift(block._component_mask_shift),
       _currentCcAdjOrder(block._currentCcAdjOrder)
 {
+  block.ensureWires();
+  block.ensureParasitics();
+  _lazy_wires_pending = false;
+  _lazy_parasitics_pending = false;
+
   if (block._name) {
     _name = strdup(block._name);
     ZALLOCATED(_name);
@@ -567,6 +576,7 @@ _dbBlock::_dbBlock(_dbDatabase* db, const _dbBlock& block)
 
   // ??? Initialize search-db on copy?
   _searchDb = nullptr;
+  _spatial_index = nullptr;
 
   // ??? callbacks
   // _callbacks = ???
@@ -646,6 +656,8 @@ _dbBlock::~_dbBlock()
   delete _bpin_itr;
   delete _prop_itr;
 
+  delete _spatial_index.load();
+
   std::list<dbBlockCallBackObj*>::iterator _cbitr;
   while (_callbacks.begin() != _callbacks.end()) {
     _cbitr = _callbacks.begin();
@@ -811,21 +823,27 @@ dbObjectTable* _dbBlock::getObjectTable(dbObjectType type)
       return _blockage_tbl;
 
     case dbWireObj:
+      ensureWires();
       return _wire_tbl;
 
     case dbSWireObj:
+      ensureWires();
       return _swire_tbl;
 
     case dbSBoxObj:
+      ensureWires();
       return _sbox_tbl;
 
     case dbCapNodeObj:
+      ensureParasitics();
       return _cap_node_tbl;
 
     case dbRSegObj:
+      ensureParasitics();
       return _r_seg_tbl;
 
     case dbCCSegObj:
+      ensureParasitics();
       return _cc_seg_tbl;
 
     case dbRowObj:
@@ -866,6 +884,9 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
     (**cbitr)().inDbBlockStreamOutBefore(
         (dbBlock*) &block);  // client ECO initialization  - payam
 
+  block.ensureWires();
+  block.ensureParasitics();
+
   stream << block._def_units;
   stream << block._dbu_per_micron;
   stream << block._hier_delimeter;
@@ -924,9 +945,11 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block._track_grid_tbl;
   stream << *block._obstruction_tbl;
   stream << *block._blockage_tbl;
+  const uint64_t wires = stream.beginSection();
   stream << *block._wire_tbl;
   stream << *block._swire_tbl;
   stream << *block._sbox_tbl;
+  stream.endSection(wires);
   stream << *block._row_tbl;
   stream << *block._fill_tbl;
   stream << *block._region_tbl;
@@ -936,6 +959,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block._layer_rule_tbl;
   stream << *block._prop_tbl;
   stream << *block._name_cache;
+  const uint64_t parasitics = stream.beginSection();
   stream << *block._r_val_tbl;
   stream << *block._c_val_tbl;
   stream << *block._cc_val_tbl;
@@ -943,6 +967,7 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   stream << *block._r_seg_tbl;     // DKF - 2/21/05
   stream << *block._cc_seg_tbl;
   stream << *block._extControl;
+  stream.endSection(parasitics);
 
   //---------------------------------------------------------- stream out
   // properties
@@ -960,6 +985,104 @@ dbOStream& operator<<(dbOStream& stream, const _dbBlock& block)
   return stream;
 }
 
+static void streamInWires(dbIStream& stream, _dbBlock& block)
+{
+  stream >> *block._wire_tbl;
+  stream >> *block._swire_tbl;
+  stream >> *block._sbox_tbl;
+}
+
+static void streamInParasitics(dbIStream& stream, _dbBlock& block)
+{
+  stream >> *block._r_val_tbl;
+  stream >> *block._c_val_tbl;
+  stream >> *block._cc_val_tbl;
+  stream >> *block._cap_node_tbl;  // DKF
+  stream >> *block._r_seg_tbl;     // DKF
+  stream >> *block._cc_seg_tbl;
+  stream >> *block._extControl;
+}
+
+// Reads a size prefixed section, or just records where it is when the
+// database is being read lazily.
+static void streamInSection(dbIStream& stream,
+                            _dbBlock& block,
+                            _dbLazySection& section,
+                            std::atomic<bool>& pending,
+                            void (*read)(dbIStream&, _dbBlock&))
+{
+  _dbDatabase* db = block.getDatabase();
+  if (!db->isSchema(db_schema_block_lazy_sections)) {
+    read(stream, block);
+    return;
+  }
+
+  uint64_t size;
+  stream >> size;
+  if (size == 0 || db->_lazy_file.empty()) {
+    read(stream, block);
+    return;
+  }
+
+  section._file = db->_lazy_file;
+  section._schema = db->_schema_minor;
+  section._offset = stream.tell() - sizeof(size);
+  section._size = size;
+  stream.skip(size);
+  pending.store(true, std::memory_order_release);
+}
+
+void _dbBlock::loadLazyWires() const
+{
+  loadLazySection(_lazy_wires, _lazy_wires_pending, streamInWires);
+}
+
+void _dbBlock::loadLazyParasitics() const
+{
+  loadLazySection(
+      _lazy_parasitics, _lazy_parasitics_pending, streamInParasitics);
+}
+
+void _dbBlock::loadLazySection(const _dbLazySection& section,
+                               std::atomic<bool>& pending,
+                               void (*read)(dbIStream&, _dbBlock&)) const
+{
+  std::lock_guard<std::mutex> lock(_lazy_mutex);
+  if (!pending.load(std::memory_order_relaxed)) {
+    return;
+  }
+
+  _dbBlock* block = const_cast<_dbBlock*>(this);
+  _dbDatabase* db = block->getDatabase();
+  std::ifstream file(section._file, std::ios::binary);
+  if (!file) {
+    throw ZException("cannot open %s to load deferred block data",
+                     section._file.c_str());
+  }
+  file.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  file.seekg(section._offset);
+
+  // The section has to be read with the schema of the file it came from.
+  const uint schema = db->_schema_minor;
+  db->_schema_minor = section._schema;
+  try {
+    dbIStream stream(db, file);
+    uint64_t size;
+    stream >> size;
+    if (size != section._size) {
+      throw ZException("%s changed since it was read", section._file.c_str());
+    }
+    read(stream, *block);
+  } catch (...) {
+    db->_schema_minor = schema;
+    throw;
+  }
+  db->_schema_minor = schema;
+
+  pending.store(false, std::memory_order_release);
+}
+
 dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
 {
   _dbDatabase* db = block.getImpl()->getDatabase();
@@ -1038,9 +1161,11 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> *block._track_grid_tbl;
   stream >> *block._obstruction_tbl;
   stream >> *block._blockage_tbl;
-  stream >> *block._wire_tbl;
-  stream >> *block._swire_tbl;
-  stream >> *block._sbox_tbl;
+  streamInSection(stream,
+                  block,
+                  block._lazy_wires,
+                  block._lazy_wires_pending,
+                  streamInWires);
   stream >> *block._row_tbl;
   stream >> *block._fill_tbl;
   stream >> *block._region_tbl;
@@ -1050,13 +1175,11 @@ dbIStream& operator>>(dbIStream& stream, _dbBlock& block)
   stream >> *block._layer_rule_tbl;
   stream >> *block._prop_tbl;
   stream >> *block._name_cache;
-  stream >> *block._r_val_tbl;
-  stream >> *block._c_val_tbl;
-  stream >> *block._cc_val_tbl;
-  stream >> *block._cap_node_tbl;  // DKF
-  stream >> *block._r_seg_tbl;     // DKF
-  stream >> *block._cc_seg_tbl;
-  stream >> *block._extControl;
+  streamInSection(stream,
+                  block,
+                  block._lazy_parasitics,
+                  block._lazy_parasitics_pending,
+                  streamInParasitics);
 
   //---------------------------------------------------------- stream in
   // properties
@@ -1101,6 +1224,11 @@ void _dbBlock::remove_rect(const Rect& rect)
 
 bool _dbBlock::operator==(const _dbBlock& rhs) const
 {
+  ensureWires();
+  ensureParasitics();
+  rhs.ensureWires();
+  rhs.ensureParasitics();
+
   if (_flags._valid_bbox != rhs._flags._valid_bbox)
     return false;
 
@@ -1341,6 +1469,11 @@ void _dbBlock::differences(dbDiff& diff,
                            const char* field,
                            const _dbBlock& rhs) const
 {
+  ensureWires();
+  ensureParasitics();
+  rhs.ensureWires();
+  rhs.ensureParasitics();
+
   DIFF_BEGIN
   DIFF_FIELD(_flags._valid_bbox);
   DIFF_FIELD(_def_units);
@@ -1435,6 +1568,9 @@ void _dbBlock::differences(dbDiff& diff,
 
 void _dbBlock::out(dbDiff& diff, char side, const char* field) const
 {
+  ensureWires();
+  ensureParasitics();
+
   DIFF_OUT_BEGIN
   DIFF_OUT_FIELD(_flags._valid_bbox);
   DIFF_OUT_FIELD(_def_units);
@@ -1596,6 +1732,7 @@ void dbBlock::ComputeBBox()
     bbox->_shape._rect.merge(box->_shape._rect);
   }
 
+  block->ensureWires();
   dbSet<dbSBox> sboxes(block, block->_sbox_tbl);
   dbSet<dbSBox>::iterator sitr;
 
@@ -1889,6 +2026,7 @@ dbSet<dbNet> dbBlock::getNets()
 dbSet<dbCapNode> dbBlock::getCapNodes()
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->ensureParasitics();
   return dbSet<dbCapNode>(block, block->_cap_node_tbl);
 }
 
@@ -2167,6 +2305,7 @@ void* dbBlock::getExtmi()
 dbExtControl* dbBlock::getExtControl()
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->ensureParasitics();
   return (block->_extControl);
 }
 
@@ -2182,12 +2321,14 @@ void dbBlock::getExtCornerNames(std::list<std::string>& ecl)
 dbSet<dbCCSeg> dbBlock::getCCSegs()
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->ensureParasitics();
   return dbSet<dbCCSeg>(block, block->_cc_seg_tbl);
 }
 
 dbSet<dbRSeg> dbBlock::getRSegs()
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->ensureParasitics();
   return dbSet<dbRSeg>(block, block->_r_seg_tbl);
 }
 
@@ -2223,6 +2364,7 @@ void dbBlock::copyExtDb(uint fr,
                         double gndcFactor)
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->ensureParasitics();
   uint j;
   if (resFactor != 1.0) {
     for (j = 1; j < block->_r_val_tbl->size(); j += extDbCnt)
@@ -2314,6 +2456,7 @@ void dbBlock::undoAdjustedCC(std::vector<dbNet*>& nets,
 void dbBlock::adjustRC(double resFactor, double ccFactor, double gndcFactor)
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->ensureParasitics();
   uint j;
   if (resFactor != 1.0) {
     for (j = 1; j < block->_r_val_tbl->size(); j++)
@@ -2335,6 +2478,7 @@ void dbBlock::getExtCount(int& numOfNet,
                           int& numOfCCSeg)
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->ensureParasitics();
   numOfNet = block->_net_tbl->size();
   numOfRSeg = block->_r_seg_tbl->size();
   numOfCapNode = block->_cap_node_tbl->size();
@@ -2389,6 +2533,7 @@ int dbBlock::getExtDbCount()
 void dbBlock::initParasiticsValueTables()
 {
   _dbBlock* block = (_dbBlock*) this;
+  block->ensureParasitics();
   if ((block->_r_seg_tbl->size() > 0) || (block->_cap_node_tbl->size() > 0)
       || (block->_cc_seg_tbl->size() > 0)) {
     dbSet<dbNet> nets = getNets();
@@ -2777,6 +2922,21 @@ dbBlockSearch* dbBlock::getSearchDb()
   return block->_searchDb;
 }
 
+dbSpatialIndex* dbBlock::getSpatialIndex()
+{
+  _dbBlock* block = (_dbBlock*) this;
+  dbSpatialIndex* index = block->_spatial_index.load(std::memory_order_acquire);
+  if (index == nullptr) {
+    std::lock_guard<std::mutex> lock(block->_spatial_index_mutex);
+    index = block->_spatial_index.load(std::memory_order_relaxed);
+    if (index == nullptr) {
+      index = new dbSpatialIndex(this);
+      block->_spatial_index.store(index, std::memory_order_release);
+    }
+  }
+  return index;
+}
+
 #ifdef ZUI
 ZPtr<ISdb> dbBlock::getSignalNetSdb(ZContext& context, dbTech* tech)
 {
@@ -32,7 +32,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
+#include <mutex>
+#include <string>
 #include <vector>
 
 #include "dbCore.h"
@@ -128,7 +131,20 @@ class dbExtControl;
 class dbIStream;
 class dbOStream;
 class dbDiff;
+
+//
+// A section of a block that dbDatabase::readLazy skipped over.  It is
+// streamed in from the same file on first use.
+//
+struct _dbLazySection
+{
+  std::string _file;
+  uint _schema = 0;      // schema the file was written with
+  uint64_t _offset = 0;  // of the section size
+  uint64_t _size = 0;
+};
 class dbBlockSearch;
+class dbSpatialIndex;
 class dbBlockCallBackObj;
 class dbGuideItr;
 class dbNetTrackItr;
@@ -255,6 +271,8 @@ class _dbBlock : public _dbObject
   dbBPinItr* _bpin_itr;
   dbPropertyItr* _prop_itr;
   dbBlockSearch* _searchDb;
+  std::atomic<dbSpatialIndex*> _spatial_index;
+  std::mutex _spatial_index_mutex;
 
   unsigned char _num_ext_dbs;
 
@@ -264,6 +282,14 @@ class _dbBlock : public _dbObject
   dbJournal* _journal;
   dbJournal* _journal_pending;
 
+  // Wires (_wire_tbl, _swire_tbl, _sbox_tbl) and parasitics (_r_val_tbl
+  // through _extControl) that have not been read yet.
+  _dbLazySection _lazy_wires;
+  _dbLazySection _lazy_parasitics;
+  mutable std::atomic<bool> _lazy_wires_pending;
+  mutable std::atomic<bool> _lazy_parasitics_pending;
+  mutable std::mutex _lazy_mutex;
+
   _dbBlock(_dbDatabase* db);
   _dbBlock(_dbDatabase* db, const _dbBlock& block);
   ~_dbBlock();
@@ -286,6 +312,27 @@ class _dbBlock : public _dbObject
   _dbTech* getTech();
 
   dbObjectTable* getObjectTable(dbObjectType type);
+
+  // Read the wire/parasitic tables if they were skipped by a lazy read.
+  // Must be called before any of those tables are touched.
+  void ensureWires() const
+  {
+    if (_lazy_wires_pending.load(std::memory_order_acquire)) {
+      loadLazyWires();
+    }
+  }
+  void ensureParasitics() const
+  {
+    if (_lazy_parasitics_pending.load(std::memory_order_acquire)) {
+      loadLazyParasitics();
+    }
+  }
+
+  void loadLazyWires() const;
+  void loadLazyParasitics() const;
+  void loadLazySection(const _dbLazySection& section,
+                       std::atomic<bool>& pending,
+                       void (*read)(dbIStream&, _dbBlock&)) const;
 };
 
 dbOStream& operator<<(dbOStream& stream, const _dbBlock& block);
@@ -771,6 +771,9 @@ dbBox* dbBox::create(dbBPin* bpin_,
   bpin->_boxes = box->getOID();
 
   block->add_rect(box->_shape._rect);
+  for (auto callback : block->_callbacks) {
+    callback->inDbBPinAddBox((dbBox*) box);
+  }
   return (dbBox*) box;
 }
 
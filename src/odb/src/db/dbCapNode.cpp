@@ -972,6 +972,7 @@ dbCapNode* dbCapNode::create(dbNet* net_, uint node, bool foreign)
 {
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureParasitics();
   uint cornerCnt = block->_corners_per_block;
   _dbCapNode* seg = block->_cap_node_tbl->create();
 
@@ -1112,6 +1113,7 @@ bool dbCapNode::checkCC()
 dbCapNode* dbCapNode::getCapNode(dbBlock* block_, uint dbid_)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->ensureParasitics();
   return (dbCapNode*) block->_cap_node_tbl->getPtr(dbid_);
 }
 }  // namespace odb
@@ -33,6 +33,8 @@
 #include "dbDatabase.h"
 
 #include <algorithm>
+#include <filesystem>
+#include <fstream>
 #include <map>
 #include <string>
 
@@ -453,6 +455,36 @@ void dbDatabase::read(std::ifstream& file)
   stream >> *db;
 }
 
+void dbDatabase::readLazy(const char* file_name)
+{
+  _dbDatabase* db = (_dbDatabase*) this;
+  std::ifstream file;
+  file.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  file.open(file_name, std::ios::binary);
+
+  // Sections are read later by path, possibly after a cd.
+  db->_lazy_file = std::filesystem::absolute(file_name).string();
+  try {
+    read(file);
+  } catch (...) {
+    db->_lazy_file.clear();
+    throw;
+  }
+  db->_lazy_file.clear();
+}
+
+void dbDatabase::loadLazySections()
+{
+  _dbDatabase* db = (_dbDatabase*) this;
+  for (_dbChip* chip : dbSet<_dbChip>(db, db->_chip_tbl)) {
+    for (_dbBlock* block : dbSet<_dbBlock>(chip, chip->_block_tbl)) {
+      block->ensureWires();
+      block->ensureParasitics();
+    }
+  }
+}
+
 void dbDatabase::readTech(std::ifstream& file)
 {
   _dbDatabase* db = (_dbDatabase*) this;
@@ -515,6 +547,7 @@ void dbDatabase::readNets(std::ifstream& file, dbBlock* block)
 void dbDatabase::readWires(std::ifstream& file, dbBlock* block)
 {
   _dbDatabase* db = (_dbDatabase*) this;
+  ((_dbBlock*) block)->ensureWires();
   dbIStream stream(db, file);
   stream >> *((_dbBlock*) block)->_wire_tbl;
 }
@@ -522,6 +555,7 @@ void dbDatabase::readWires(std::ifstream& file, dbBlock* block)
 void dbDatabase::readParasitics(std::ifstream& file, dbBlock* block)
 {
   _dbDatabase* db = (_dbDatabase*) this;
+  ((_dbBlock*) block)->ensureParasitics();
   dbIStream stream(db, file);
   stream >> ((_dbBlock*) block)->_num_ext_corners;
   stream >> ((_dbBlock*) block)->_corner_name_list;
@@ -552,6 +586,7 @@ void dbDatabase::write(FILE* file)
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
   stream << *db;
+  stream.flush();
   fflush(file);
 }
 
@@ -565,6 +600,7 @@ void dbDatabase::writeTech(FILE* file)
 
   dbOStream stream(db, file);
   stream << *tech;
+  stream.flush();
   fflush(file);
 }
 
@@ -573,6 +609,7 @@ void dbDatabase::writeLib(FILE* file, dbLib* lib)
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
   stream << *(_dbLib*) lib;
+  stream.flush();
   fflush(file);
 }
 
@@ -581,6 +618,7 @@ void dbDatabase::writeLibs(FILE* file)
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
   stream << *db->_lib_tbl;
+  stream.flush();
   fflush(file);
 }
 
@@ -589,6 +627,7 @@ void dbDatabase::writeBlock(FILE* file, dbBlock* block)
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
   stream << *(_dbBlock*) block;
+  stream.flush();
   fflush(file);
 }
 
@@ -597,20 +636,24 @@ void dbDatabase::writeNets(FILE* file, dbBlock* block)
   _dbDatabase* db = (_dbDatabase*) this;
   dbOStream stream(db, file);
   stream << *((_dbBlock*) block)->_net_tbl;
+  stream.flush();
   fflush(file);
 }
 
 void dbDatabase::writeWires(FILE* file, dbBlock* block)
 {
   _dbDatabase* db = (_dbDatabase*) this;
+  ((_dbBlock*) block)->ensureWires();
   dbOStream stream(db, file);
   stream << *((_dbBlock*) block)->_wire_tbl;
+  stream.flush();
   fflush(file);
 }
 
 void dbDatabase::writeParasitics(FILE* file, dbBlock* block)
 {
   _dbDatabase* db = (_dbDatabase*) this;
+  ((_dbBlock*) block)->ensureParasitics();
   dbOStream stream(db, file);
   stream << ((_dbBlock*) block)->_num_ext_corners;
   stream << ((_dbBlock*) block)->_corner_name_list;
@@ -621,6 +664,7 @@ void dbDatabase::writeParasitics(FILE* file, dbBlock* block)
   stream << *((_dbBlock*) block)->_r_seg_tbl;
   stream << *((_dbBlock*) block)->_cc_seg_tbl;
   stream << *((_dbBlock*) block)->_extControl;
+  stream.flush();
   fflush(file);
 }
 
@@ -630,6 +674,7 @@ void dbDatabase::writeChip(FILE* file)
   _dbChip* chip = (_dbChip*) getChip();
   dbOStream stream(db, file);
   stream << *chip;
+  stream.flush();
   fflush(file);
 }
 
@@ -637,6 +682,14 @@ void dbDatabase::beginEco(dbBlock* block_)
 {
   _dbBlock* block = (_dbBlock*) block_;
 
+  if (block->_journal && block->_journal->_transaction) {
+    block->getImpl()->getLogger()->error(
+        utl::ODB,
+        438,
+        "Cannot begin an eco on block {} while a transaction is in progress.",
+        block->_name);
+  }
+
   if (block->_journal)
     delete block->_journal;
 
@@ -647,6 +700,15 @@ void dbDatabase::beginEco(dbBlock* block_)
 void dbDatabase::endEco(dbBlock* block_)
 {
   _dbBlock* block = (_dbBlock*) block_;
+
+  if (block->_journal && block->_journal->_transaction) {
+    block->getImpl()->getLogger()->error(
+        utl::ODB,
+        439,
+        "Cannot end an eco on block {} while a transaction is in progress.",
+        block->_name);
+  }
+
   dbJournal* eco = block->_journal;
   block->_journal = nullptr;
 
@@ -712,6 +774,7 @@ void dbDatabase::writeEco(dbBlock* block_, const char* filename)
   if (block->_journal_pending) {
     dbOStream stream(block->getDatabase(), file);
     stream << *block->_journal_pending;
+    stream.flush();
   }
 
   fclose(file);
@@ -731,6 +794,69 @@ void dbDatabase::commitEco(dbBlock* block_)
   }
 }
 
+void dbDatabase::beginTransaction(dbBlock* block_)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+
+  if (block->_journal) {
+    block->getImpl()->getLogger()->error(
+        utl::ODB,
+        436,
+        "Cannot begin a transaction on block {} while another transaction or "
+        "eco is in progress.",
+        block->_name);
+  }
+
+  block->_journal = new dbJournal(block_);
+  block->_journal->_transaction = true;
+}
+
+uint dbDatabase::transactionSavepoint(dbBlock* block_)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+
+  if (block->_journal == nullptr || !block->_journal->_transaction) {
+    block->getImpl()->getLogger()->error(
+        utl::ODB, 437, "No transaction in progress on block {}.", block->_name);
+  }
+
+  return block->_journal->size();
+}
+
+void dbDatabase::rollbackTransaction(dbBlock* block_, uint savepoint)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+  dbJournal* journal = block->_journal;
+
+  if (journal == nullptr || !journal->_transaction) {
+    block->getImpl()->getLogger()->error(
+        utl::ODB, 437, "No transaction in progress on block {}.", block->_name);
+  }
+
+  // Detach the journal so the undo itself is not journaled.
+  block->_journal = nullptr;
+  try {
+    journal->undo(savepoint);
+  } catch (...) {
+    block->_journal = journal;
+    throw;
+  }
+  block->_journal = journal;
+}
+
+void dbDatabase::commitTransaction(dbBlock* block_)
+{
+  _dbBlock* block = (_dbBlock*) block_;
+
+  if (block->_journal == nullptr || !block->_journal->_transaction) {
+    block->getImpl()->getLogger()->error(
+        utl::ODB, 437, "No transaction in progress on block {}.", block->_name);
+  }
+
+  delete block->_journal;
+  block->_journal = nullptr;
+}
+
 void dbDatabase::setLogger(utl::Logger* logger)
 {
   _dbDatabase* _db = (_dbDatabase*) this;
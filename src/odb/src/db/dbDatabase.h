@@ -33,6 +33,7 @@
 #pragma once
 
 #include <iostream>
+#include <string>
 
 #include "dbCore.h"
 #include "odb.h"
@@ -69,7 +70,11 @@ namespace odb {
 //
 const uint db_schema_major = 0;  // Not used...
 const uint db_schema_initial = 57;
-const uint db_schema_minor = 68;  // Current revision number
+const uint db_schema_minor = 69;  // Current revision number
+
+// Revision where the wire and parasitic sections of _dbBlock are prefixed
+// with their size so they can be skipped.
+const uint db_schema_block_lazy_sections = 69;
 
 // Revision where _component_shift_mask is added to _dbBlock.
 const uint db_schema_block_component_mask_shift = 68;
@@ -134,6 +139,8 @@ class _dbDatabase : public _dbObject
   _dbNameCache* _name_cache;
   dbPropertyItr* _prop_itr;
   int _unique_id;
+  // File being read by dbDatabase::readLazy.
+  std::string _lazy_file;
 
   utl::Logger* _logger;
 
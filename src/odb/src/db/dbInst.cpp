@@ -450,6 +450,17 @@ bool dbInst::rename(const char* name)
   if (block->_inst_hash.hasMember(name))
     return false;
 
+  if (block->_journal) {
+    debugPrint(getImpl()->getLogger(),
+               utl::ODB,
+               "DB_ECO",
+               1,
+               "ECO: inst {}, rename to {}",
+               getId(),
+               name);
+    block->_journal->updateField(this, _dbInst::NAME, inst->_name, name);
+  }
+
   block->_inst_hash.remove(inst);
   free((void*) inst->_name);
   inst->_name = strdup(name);
@@ -1341,6 +1352,13 @@ dbInst* dbInst::create(dbBlock* block_,
         name_);
   }
 
+  _dbInst* inst = block->_inst_tbl->create();
+  inst->_name = strdup(name_);
+  ZALLOCATED(inst->_name);
+  inst->_inst_hdr = inst_hdr->getOID();
+  block->_inst_hash.insert(inst);
+  inst_hdr->_inst_cnt++;
+
   if (block->_journal) {
     debugPrint(block->getImpl()->getLogger(),
                utl::ODB,
@@ -1353,16 +1371,10 @@ dbInst* dbInst::create(dbBlock* block_,
     block->_journal->pushParam(lib->getId());
     block->_journal->pushParam(master_->getId());
     block->_journal->pushParam(name_);
+    block->_journal->pushParam(inst->getOID());
     block->_journal->endAction();
   }
 
-  _dbInst* inst = block->_inst_tbl->create();
-  inst->_name = strdup(name_);
-  ZALLOCATED(inst->_name);
-  inst->_inst_hdr = inst_hdr->getOID();
-  block->_inst_hash.insert(inst);
-  inst_hdr->_inst_cnt++;
-
   // create the iterms
   uint mterm_cnt = inst_hdr->_mterms.size();
   inst->_iterms.resize(mterm_cnt);
@@ -1439,10 +1451,9 @@ void dbInst::destroy(dbInst* inst_)
   if (inst->_group)
     inst_->getGroup()->removeInst(inst_);
 
-  uint i;
-  uint n = inst->_iterms.size();
-
-  for (i = 0; i < n; ++i) {
+  // The iterms are released in reverse so that the table's free list hands
+  // them back in order should the instance be recreated by a rollback.
+  for (int i = inst->_iterms.size() - 1; i >= 0; --i) {
     dbId<_dbITerm> id = inst->_iterms[i];
     _dbITerm* it = block->_iterm_tbl->getPtr(id);
     ((dbITerm*) it)->disconnect();
@@ -1475,9 +1486,19 @@ void dbInst::destroy(dbInst* inst_)
                "DB_ECO",
                1,
                "ECO: dbInst:destroy");
+    dbMaster* master = inst_->getMaster();
     block->_journal->beginAction(dbJournal::DELETE_OBJECT);
     block->_journal->pushParam(dbInstObj);
     block->_journal->pushParam(inst->getId());
+    // The remaining params are only used to undo the delete.
+    block->_journal->pushParam(inst->_name);
+    block->_journal->pushParam(master->getLib()->getId());
+    block->_journal->pushParam(master->getId());
+    block->_journal->pushParam(region ? region->getId() : 0);
+    block->_journal->pushParam(module ? module->getId() : 0);
+    block->_journal->pushParam(inst->_x);
+    block->_journal->pushParam(inst->_y);
+    block->_journal->pushParam(flagsToUInt(inst));
     block->_journal->endAction();
   }
 
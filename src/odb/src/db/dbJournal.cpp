@@ -32,6 +32,8 @@
 
 #include "dbJournal.h"
 
+#include <cstring>
+
 #include "db.h"
 #include "dbBTerm.h"
 #include "dbBlock.h"
@@ -50,7 +52,8 @@ dbJournal::dbJournal(dbBlock* block)
       _logger(block->getImpl()->getLogger()),
       _start_action(false),
       _action_idx(0),
-      _cur_action(0)
+      _cur_action(0),
+      _transaction(false)
 {
 }
 
@@ -289,7 +292,9 @@ void dbJournal::redo_createObject()
   switch ((dbObjectType) obj_type) {
     case dbNetObj: {
       std::string name;
+      uint net_id;
       _log.pop(name);
+      _log.pop(net_id);
       debugPrint(_logger,
                  utl::ODB,
                  "DB_ECO",
@@ -303,8 +308,10 @@ void dbJournal::redo_createObject()
     case dbBTermObj: {
       uint dbNet_id;
       std::string name;
+      uint bterm_id;
       _log.pop(dbNet_id);
       _log.pop(name);
+      _log.pop(bterm_id);
 
       dbNet* net = dbNet::getNet(_block, dbNet_id);
       debugPrint(_logger,
@@ -322,9 +329,11 @@ void dbJournal::redo_createObject()
       uint lib_id;
       uint master_id;
       std::string name;
+      uint inst_id;
       _log.pop(lib_id);
       _log.pop(master_id);
       _log.pop(name);
+      _log.pop(inst_id);
       dbLib* lib = dbLib::getLib(_block->getDb(), lib_id);
       dbMaster* master = dbMaster::getMaster(lib, master_id);
       debugPrint(_logger,
@@ -420,6 +429,10 @@ void dbJournal::redo_deleteObject()
     case dbNetObj: {
       uint net_id;
       _log.pop(net_id);
+      std::string name;
+      _log.pop(name);
+      uint flags;
+      _log.pop(flags);
       dbNet* net = dbNet::getNet(_block, net_id);
       debugPrint(_logger,
                  utl::ODB,
@@ -434,6 +447,12 @@ void dbJournal::redo_deleteObject()
     case dbBTermObj: {
       uint bterm_id;
       _log.pop(bterm_id);
+      uint net_id;
+      _log.pop(net_id);
+      std::string name;
+      _log.pop(name);
+      uint flags;
+      _log.pop(flags);
       dbBTerm* bterm = dbBTerm::getBTerm(_block, bterm_id);
       debugPrint(_logger,
                  utl::ODB,
@@ -447,6 +466,8 @@ void dbJournal::redo_deleteObject()
     case dbInstObj: {
       uint inst_id;
       _log.pop(inst_id);
+      InstState state;
+      popInstState(state);
       dbInst* inst = dbInst::getInst(_block, inst_id);
       debugPrint(_logger,
                  utl::ODB,
@@ -586,6 +607,8 @@ void dbJournal::redo_disconnectObject()
     case dbITermObj: {
       uint iterm_id;
       _log.pop(iterm_id);
+      uint net_id;
+      _log.pop(net_id);
       dbITerm* iterm = dbITerm::getITerm(_block, iterm_id);
       debugPrint(_logger,
                  utl::ODB,
@@ -600,6 +623,8 @@ void dbJournal::redo_disconnectObject()
     case dbBTermObj: {
       uint bterm_id;
       _log.pop(bterm_id);
+      uint net_id;
+      _log.pop(net_id);
       dbBTerm* bterm = dbBTerm::getBTerm(_block, bterm_id);
       bterm->disconnect();
 
@@ -862,6 +887,23 @@ void dbJournal::redo_updateNetField()
       break;
     }
 
+    case _dbNet::NAME: {
+      std::string prev_name;
+      std::string name;
+      _log.pop(prev_name);
+      _log.pop(name);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "REDO ECO: dbNet {}, rename {} to {}",
+                 net_id,
+                 prev_name,
+                 name);
+      ((dbNet*) net)->rename(name.c_str());
+      break;
+    }
+
     default:
       break;
   }
@@ -916,6 +958,23 @@ void dbJournal::redo_updateInstField()
       break;
     }
 
+    case _dbInst::NAME: {
+      std::string prev_name;
+      std::string name;
+      _log.pop(prev_name);
+      _log.pop(name);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "REDO ECO: dbInst {}, rename {} to {}",
+                 inst_id,
+                 prev_name,
+                 name);
+      ((dbInst*) inst)->rename(name.c_str());
+      break;
+    }
+
     default:
       break;
   }
@@ -946,6 +1005,23 @@ void dbJournal::redo_updateBTermField()
                  *flags);
       break;
     }
+
+    case _dbBTerm::NAME: {
+      std::string prev_name;
+      std::string name;
+      _log.pop(prev_name);
+      _log.pop(name);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "REDO ECO: dbBTerm {}, rename {} to {}",
+                 bterm_id,
+                 prev_name,
+                 name);
+      ((dbBTerm*) bterm)->rename(name.c_str());
+      break;
+    }
   }
 }
 void dbJournal::redo_updateITermField()
@@ -1369,57 +1445,195 @@ void dbJournal::redo_updateCCSegField()
   }
 }
 
+void dbJournal::popInstState(InstState& state)
+{
+  _log.pop(state.name);
+  _log.pop(state.lib_id);
+  _log.pop(state.master_id);
+  _log.pop(state.region_id);
+  _log.pop(state.module_id);
+  _log.pop(state.x);
+  _log.pop(state.y);
+  _log.pop(state.flags);
+}
+
 //
-// WORK-IN-PROGRESS undo does not yet work.
+// Only netlist and placement actions can be undone. Scan the actions to be
+// undone before touching the block so an unsupported one leaves it intact.
 //
-void dbJournal::undo()
+void dbJournal::checkUndo(uint savepoint)
 {
-  if (_log.empty())
-    return;
+  uint end = _log.size();
 
-  _log.set(_log.size() - sizeof(uint));
-
-  for (;;) {
+  while (end > savepoint) {
     uint action_idx;
-    _log.pop(action_idx);
+    _log.popLast(end, action_idx);
     _log.set(action_idx);
-    _log.pop(_cur_action);
 
-    switch (_cur_action) {
+    unsigned char action;
+    int obj_type;
+    _log.pop(action);
+    _log.pop(obj_type);
+
+    bool supported = false;
+    switch (action) {
       case CREATE_OBJECT:
-        undo_createObject();
+        supported = obj_type == dbInstObj || obj_type == dbNetObj
+                    || obj_type == dbBTermObj;
         break;
 
       case DELETE_OBJECT:
-        undo_deleteObject();
+        supported = obj_type == dbInstObj || obj_type == dbNetObj;
+        if (obj_type == dbBTermObj) {
+          uint bterm_id;
+          uint net_id;
+          _log.pop(bterm_id);
+          _log.pop(net_id);
+          supported = net_id != 0;
+        }
         break;
 
       case CONNECT_OBJECT:
-        undo_connectObject();
-        break;
-
       case DISCONNECT_OBJECT:
-        undo_disconnectObject();
+        supported = obj_type == dbITermObj || obj_type == dbBTermObj;
         break;
 
       case SWAP_OBJECT:
-        undo_swapObject();
+        supported = obj_type == dbInstObj;
         break;
 
-      case UPDATE_FIELD:
-        undo_updateField();
+      case UPDATE_FIELD: {
+        uint obj_id;
+        int field;
+        _log.pop(obj_id);
+        _log.pop(field);
+        switch ((dbObjectType) obj_type) {
+          case dbInstObj:
+            supported = field == _dbInst::FLAGS || field == _dbInst::ORIGIN
+                        || field == _dbInst::NAME;
+            break;
+          case dbNetObj:
+            supported = field == _dbNet::FLAGS
+                        || field == _dbNet::NON_DEFAULT_RULE
+                        || field == _dbNet::NAME;
+            break;
+          case dbBTermObj:
+            supported = field == _dbBTerm::FLAGS || field == _dbBTerm::NAME;
+            break;
+          case dbITermObj:
+            supported = field == _dbITerm::FLAGS;
+            break;
+          default:
+            break;
+        }
         break;
+      }
+    }
 
-      default:
-        assert(0);
-        break;
+    if (!supported) {
+      _logger->error(utl::ODB,
+                     434,
+                     "Cannot roll back journal action {} on {}.",
+                     action,
+                     dbObject::getObjName((dbObjectType) obj_type));
     }
 
-    if (action_idx == 0)
-      break;
+    end = action_idx;
+  }
+}
+
+void dbJournal::undo(uint savepoint)
+{
+  checkUndo(savepoint);
 
-    _log.set(action_idx -= sizeof(uint));
+  uint end = _log.size();
+
+  while (end > savepoint) {
+    uint action_idx;
+    _log.popLast(end, action_idx);
+    _log.set(action_idx);
+    _log.pop(_cur_action);
+
+    try {
+      switch (_cur_action) {
+        case CREATE_OBJECT:
+          undo_createObject();
+          break;
+
+        case DELETE_OBJECT:
+          undo_deleteObject();
+          break;
+
+        case CONNECT_OBJECT:
+          undo_connectObject();
+          break;
+
+        case DISCONNECT_OBJECT:
+          undo_disconnectObject();
+          break;
+
+        case SWAP_OBJECT:
+          undo_swapObject();
+          break;
+
+        case UPDATE_FIELD:
+          undo_updateField();
+          break;
+
+        default:
+          assert(0);
+          break;
+      }
+    } catch (...) {
+      // The actions after this one are undone; drop them so the log still
+      // describes the block.
+      _log.truncate(end);
+      throw;
+    }
+
+    end = action_idx;
+  }
+
+  _log.truncate(savepoint);
+}
+
+//
+// Objects destroyed in the log are recreated by the normal create path.
+// As every later action has already been undone, the tables' free lists
+// are back in the state they had at the delete, so the object gets its old
+// id back.  Check that so later undo steps resolve to the right object.
+// Only a change made behind the journal's back can break this; the
+// recreated object is then destroyed again so the block is left exactly as
+// it was after the action that could not be undone.
+//
+void dbJournal::checkRestoredId(dbObject* obj, uint id, const char* name)
+{
+  const uint restored_id = obj->getId();
+  if (restored_id == id) {
+    return;
+  }
+
+  const char* obj_name = obj->getObjName();
+  switch (obj->getObjectType()) {
+    case dbNetObj:
+      dbNet::destroy((dbNet*) obj);
+      break;
+    case dbBTermObj:
+      dbBTerm::destroy((dbBTerm*) obj);
+      break;
+    case dbInstObj:
+      dbInst::destroy((dbInst*) obj);
+      break;
+    default:
+      break;
   }
+  _logger->error(utl::ODB,
+                 435,
+                 "Rollback restored {} {} with id {} instead of {}.",
+                 obj_name,
+                 name,
+                 restored_id,
+                 id);
 }
 
 void dbJournal::undo_createObject()
@@ -1428,11 +1642,59 @@ void dbJournal::undo_createObject()
   _log.pop(obj_type);
 
   switch ((dbObjectType) obj_type) {
-    case dbNetObj:
-    case dbInstObj:
-    case dbRSegObj:
-    case dbCapNodeObj:
-    case dbCCSegObj:
+    case dbNetObj: {
+      std::string name;
+      uint net_id;
+      _log.pop(name);
+      _log.pop(net_id);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: destroy dbNet {}, net_id {}",
+                 name,
+                 net_id);
+      dbNet::destroy(dbNet::getNet(_block, net_id));
+      break;
+    }
+
+    case dbBTermObj: {
+      uint net_id;
+      std::string name;
+      uint bterm_id;
+      _log.pop(net_id);
+      _log.pop(name);
+      _log.pop(bterm_id);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: destroy dbBTerm {}, bterm_id {}",
+                 name,
+                 bterm_id);
+      dbBTerm::destroy(dbBTerm::getBTerm(_block, bterm_id));
+      break;
+    }
+
+    case dbInstObj: {
+      uint lib_id;
+      uint master_id;
+      std::string name;
+      uint inst_id;
+      _log.pop(lib_id);
+      _log.pop(master_id);
+      _log.pop(name);
+      _log.pop(inst_id);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: destroy dbInst {}, inst_id {}",
+                 name,
+                 inst_id);
+      dbInst::destroy(dbInst::getInst(_block, inst_id));
+      break;
+    }
 
     default:
       break;
@@ -1445,11 +1707,86 @@ void dbJournal::undo_deleteObject()
   _log.pop(obj_type);
 
   switch ((dbObjectType) obj_type) {
-    case dbNetObj:
-    case dbInstObj:
-    case dbRSegObj:
-    case dbCapNodeObj:
-    case dbCCSegObj:
+    case dbNetObj: {
+      uint net_id;
+      std::string name;
+      uint flags;
+      _log.pop(net_id);
+      _log.pop(name);
+      _log.pop(flags);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: create dbNet {}, net_id {}",
+                 name,
+                 net_id);
+      _dbNet* net = (_dbNet*) dbNet::create(_block, name.c_str());
+      checkRestoredId((dbNet*) net, net_id, name.c_str());
+      std::memcpy(&net->_flags, &flags, sizeof(flags));
+      break;
+    }
+
+    case dbBTermObj: {
+      uint bterm_id;
+      uint net_id;
+      std::string name;
+      uint flags;
+      _log.pop(bterm_id);
+      _log.pop(net_id);
+      _log.pop(name);
+      _log.pop(flags);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: create dbBTerm {}, bterm_id {}",
+                 name,
+                 bterm_id);
+      dbNet* net = dbNet::getNet(_block, net_id);
+      _dbBTerm* bterm = (_dbBTerm*) dbBTerm::create(net, name.c_str());
+      checkRestoredId((dbBTerm*) bterm, bterm_id, name.c_str());
+      std::memcpy(&bterm->_flags, &flags, sizeof(flags));
+      break;
+    }
+
+    case dbInstObj: {
+      uint inst_id;
+      _log.pop(inst_id);
+      InstState state;
+      popInstState(state);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: create dbInst {}, inst_id {}",
+                 state.name,
+                 inst_id);
+
+      _dbInstFlags flags;
+      std::memcpy(&flags, &state.flags, sizeof(flags));
+
+      dbLib* lib = dbLib::getLib(_block->getDb(), state.lib_id);
+      dbMaster* master = dbMaster::getMaster(lib, state.master_id);
+      dbRegion* region = state.region_id
+                             ? dbRegion::getRegion(_block, state.region_id)
+                             : nullptr;
+      dbInst* inst = dbInst::create(
+          _block, master, state.name.c_str(), region, flags._physical_only);
+      checkRestoredId(inst, inst_id, state.name.c_str());
+
+      if (state.module_id
+          && state.module_id != _block->getTopModule()->getId()) {
+        dbModule::getModule(_block, state.module_id)->addInst(inst);
+      }
+      inst->setOrient(dbOrientType((dbOrientType::Value) flags._orient));
+      inst->setOrigin(state.x, state.y);
+      inst->setPlacementStatus(
+          dbPlacementStatus((dbPlacementStatus::Value) flags._status));
+      std::memcpy(&((_dbInst*) inst)->_flags, &flags, sizeof(flags));
+      break;
+    }
+
     default:
       break;
   }
@@ -1461,7 +1798,36 @@ void dbJournal::undo_connectObject()
   _log.pop(obj_type);
 
   switch ((dbObjectType) obj_type) {
-    case dbITermObj:
+    case dbITermObj: {
+      uint iterm_id;
+      uint net_id;
+      _log.pop(iterm_id);
+      _log.pop(net_id);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: disconnect dbITermObj, iterm_id {}",
+                 iterm_id);
+      dbITerm::getITerm(_block, iterm_id)->disconnect();
+      break;
+    }
+
+    case dbBTermObj: {
+      uint bterm_id;
+      uint net_id;
+      _log.pop(bterm_id);
+      _log.pop(net_id);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: disconnect dbBTermObj, bterm_id {}",
+                 bterm_id);
+      dbBTerm::getBTerm(_block, bterm_id)->disconnect();
+      break;
+    }
+
     default:
       break;
   }
@@ -1473,7 +1839,40 @@ void dbJournal::undo_disconnectObject()
   _log.pop(obj_type);
 
   switch ((dbObjectType) obj_type) {
-    case dbITermObj:
+    case dbITermObj: {
+      uint iterm_id;
+      uint net_id;
+      _log.pop(iterm_id);
+      _log.pop(net_id);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: connect dbITermObj, iterm_id {}, net_id {}",
+                 iterm_id,
+                 net_id);
+      dbITerm::getITerm(_block, iterm_id)
+          ->connect(dbNet::getNet(_block, net_id));
+      break;
+    }
+
+    case dbBTermObj: {
+      uint bterm_id;
+      uint net_id;
+      _log.pop(bterm_id);
+      _log.pop(net_id);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: connect dbBTermObj, bterm_id {}, net_id {}",
+                 bterm_id,
+                 net_id);
+      dbBTerm::getBTerm(_block, bterm_id)
+          ->connect(dbNet::getNet(_block, net_id));
+      break;
+    }
+
     default:
       break;
   }
@@ -1485,7 +1884,27 @@ void dbJournal::undo_swapObject()
   _log.pop(obj_type);
 
   switch ((dbObjectType) obj_type) {
-    case dbInstObj:
+    case dbInstObj: {
+      uint inst_id;
+      uint prev_lib_id;
+      uint prev_master_id;
+      _log.pop(inst_id);
+      _log.pop(prev_lib_id);
+      _log.pop(prev_master_id);
+      dbLib* lib = dbLib::getLib(_block->getDb(), prev_lib_id);
+      dbMaster* master = dbMaster::getMaster(lib, prev_master_id);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: swapMaster inst {}, lib/master: {}/{}",
+                 inst_id,
+                 prev_lib_id,
+                 prev_master_id);
+      dbInst::getInst(_block, inst_id)->swapMaster(master);
+      break;
+    }
+
     default:
       break;
   }
@@ -1505,16 +1924,12 @@ void dbJournal::undo_updateField()
       undo_updateInstField();
       break;
 
-    case dbITermObj:
-      undo_updateITermField();
-      break;
-
-    case dbRSegObj:
-      undo_updateRSegField();
+    case dbBTermObj:
+      undo_updateBTermField();
       break;
 
-    case dbCapNodeObj:
-      undo_updateCapNodeField();
+    case dbITermObj:
+      undo_updateITermField();
       break;
 
     default:
@@ -1526,15 +1941,59 @@ void dbJournal::undo_updateNetField()
 {
   uint net_id;
   _log.pop(net_id);
-  //_dbNet * net = (_dbNet *) dbNet::getNet(_block, net_id );
+  _dbNet* net = (_dbNet*) dbNet::getNet(_block, net_id);
 
   int field;
   _log.pop(field);
 
   switch ((_dbNet::Field) field) {
-    case _dbNet::FLAGS:
-    case _dbNet::NON_DEFAULT_RULE:
+    case _dbNet::FLAGS: {
+      uint prev_flags;
+      _log.pop(prev_flags);
+      std::memcpy(&net->_flags, &prev_flags, sizeof(prev_flags));
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: dbNetObj {}, updateNetField: {}",
+                 net_id,
+                 prev_flags);
       break;
+    }
+
+    case _dbNet::NON_DEFAULT_RULE: {
+      uint prev_rule;
+      uint cur_rule;
+      bool prev_block_rule;
+      _log.pop(prev_rule);
+      _log.pop(cur_rule);
+      _log.pop(prev_block_rule);
+      net->_non_default_rule = prev_rule;
+      net->_flags._block_rule = prev_block_rule;
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: dbNetObj {}, updateNonDefaultRule: {}",
+                 net_id,
+                 prev_rule);
+      break;
+    }
+
+    case _dbNet::NAME: {
+      std::string prev_name;
+      _log.pop(prev_name);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: dbNet {}, rename to {}",
+                 net_id,
+                 prev_name);
+      ((dbNet*) net)->rename(prev_name.c_str());
+      break;
+    }
+
     default:
       break;
   }
@@ -1544,93 +2003,124 @@ void dbJournal::undo_updateInstField()
 {
   uint inst_id;
   _log.pop(inst_id);
-  //_dbInst * inst = (_dbInst *) dbInst::getInst(_block, inst_id );
+  _dbInst* inst = (_dbInst*) dbInst::getInst(_block, inst_id);
 
   int field;
   _log.pop(field);
 
-#if 0  // dead code generates warnings -cherry
-    switch( (_dbInst::Field) field )
-    {
-        case _dbInst::FLAGS:
-        case _dbInst::ORIGIN:
-            break;
+  switch ((_dbInst::Field) field) {
+    case _dbInst::FLAGS: {
+      uint prev_flags;
+      _log.pop(prev_flags);
+      _dbInstFlags flags;
+      std::memcpy(&flags, &prev_flags, sizeof(flags));
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: dbInst {}, updateInstField: {}",
+                 inst_id,
+                 prev_flags);
+      // Go through the setters for the fields with side effects on the
+      // bbox and the callbacks.
+      if (flags._status != inst->_flags._status) {
+        ((dbInst*) inst)
+            ->setPlacementStatus(
+                dbPlacementStatus((dbPlacementStatus::Value) flags._status));
+      }
+      if (flags._orient != inst->_flags._orient) {
+        ((dbInst*) inst)
+            ->setOrient(dbOrientType((dbOrientType::Value) flags._orient));
+      }
+      inst->_flags = flags;
+      break;
     }
-#endif
-}
 
-void dbJournal::undo_updateITermField()
-{
-  uint iterm_id;
-  _log.pop(iterm_id);
-  //_dbITerm * iterm = (_dbITerm *) dbITerm::getITerm(_block, iterm_id );
-
-  int field;
-  _log.pop(field);
-
-  switch ((_dbITerm::Field) field) {
-    case _dbITerm::FLAGS:
+    case _dbInst::ORIGIN: {
+      int prev_x;
+      int prev_y;
+      _log.pop(prev_x);
+      _log.pop(prev_y);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: dbInst {}, origin: {},{}",
+                 inst_id,
+                 prev_x,
+                 prev_y);
+      ((dbInst*) inst)->setOrigin(prev_x, prev_y);
       break;
-  }
-}
-
-void dbJournal::undo_updateRSegField()
-{
-  uint rseg_id;
-  _log.pop(rseg_id);
-  //_dbRSeg * rseg = (_dbRSeg *) dbRSeg::getRSeg(_block, rseg_id );
-
-  int field;
-  _log.pop(field);
+    }
 
-  switch ((_dbRSeg::Field) field) {
-    case _dbRSeg::FLAGS:
-    case _dbRSeg::SOURCE:
-    case _dbRSeg::TARGET:
-    case _dbRSeg::RESISTANCE:
-    case _dbRSeg::CAPACITANCE:
+    case _dbInst::NAME: {
+      std::string prev_name;
+      _log.pop(prev_name);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: dbInst {}, rename to {}",
+                 inst_id,
+                 prev_name);
+      ((dbInst*) inst)->rename(prev_name.c_str());
       break;
+    }
+
     default:
       break;
   }
 }
 
-void dbJournal::undo_updateCapNodeField()
+void dbJournal::undo_updateBTermField()
 {
-  uint node_id;
-  _log.pop(node_id);
-  //_dbCapNode * node = (_dbCapNode *) dbCapNode::getCapNode(_block, node_id );
+  uint bterm_id;
+  _log.pop(bterm_id);
+  _dbBTerm* bterm = (_dbBTerm*) dbBTerm::getBTerm(_block, bterm_id);
 
   int field;
   _log.pop(field);
 
-  switch ((_dbCapNode::Fields) field) {
-    case _dbCapNode::FLAGS:
-    case _dbCapNode::CAPACITANCE:
+  switch ((_dbBTerm::Field) field) {
+    case _dbBTerm::FLAGS: {
+      uint prev_flags;
+      _log.pop(prev_flags);
+      std::memcpy(&bterm->_flags, &prev_flags, sizeof(prev_flags));
       break;
-    default:
+    }
+
+    case _dbBTerm::NAME: {
+      std::string prev_name;
+      _log.pop(prev_name);
+      debugPrint(_logger,
+                 utl::ODB,
+                 "DB_ECO",
+                 2,
+                 "UNDO ECO: dbBTerm {}, rename to {}",
+                 bterm_id,
+                 prev_name);
+      ((dbBTerm*) bterm)->rename(prev_name.c_str());
       break;
+    }
   }
 }
 
-void dbJournal::undo_updateCCSegField()
+void dbJournal::undo_updateITermField()
 {
-  uint node_id;
-  _log.pop(node_id);
-  //_dbCCSeg * node = (_dbCCSeg *) dbCCSeg::getCCSeg(_block, node_id );
+  uint iterm_id;
+  _log.pop(iterm_id);
+  _dbITerm* iterm = (_dbITerm*) dbITerm::getITerm(_block, iterm_id);
 
   int field;
   _log.pop(field);
 
-  switch ((_dbCCSeg::Fields) field) {
-    case _dbCCSeg::FLAGS:
-    case _dbCCSeg::CAPACITANCE:
-    case _dbCCSeg::ADDCCCAPACITANCE:
-    case _dbCCSeg::SWAPCAPNODE:
-    case _dbCCSeg::LINKCCSEG:
-    case _dbCCSeg::UNLINKCCSEG:
-    case _dbCCSeg::SETALLCCCAP:
+  switch ((_dbITerm::Field) field) {
+    case _dbITerm::FLAGS: {
+      uint prev_flags;
+      _log.pop(prev_flags);
+      std::memcpy(&iterm->_flags, &prev_flags, sizeof(prev_flags));
       break;
+    }
   }
 }
 
@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include <string>
+
 #include "dbJournalLog.h"
 #include "odb.h"
 
@@ -48,6 +50,7 @@ class dbMaster;
 class dbNet;
 class dbInst;
 class dbITerm;
+class dbObject;
 
 class dbJournal
 {
@@ -57,6 +60,7 @@ class dbJournal
   bool _start_action;
   uint _action_idx;
   unsigned char _cur_action;
+  bool _transaction;  // opened by beginTransaction rather than beginEco
 
   void redo_createObject();
   void redo_deleteObject();
@@ -81,10 +85,24 @@ class dbJournal
   void undo_updateField();
   void undo_updateNetField();
   void undo_updateInstField();
+  void undo_updateBTermField();
   void undo_updateITermField();
-  void undo_updateRSegField();
-  void undo_updateCapNodeField();
-  void undo_updateCCSegField();
+
+  // What a DELETE_OBJECT of an instance records beyond its id.
+  struct InstState
+  {
+    std::string name;
+    uint lib_id;
+    uint master_id;
+    uint region_id;
+    uint module_id;
+    int x;
+    int y;
+    uint flags;
+  };
+  void popInstState(InstState& state);
+  void checkUndo(uint savepoint);
+  void checkRestoredId(dbObject* obj, uint id, const char* name);
 
  public:
   enum Action
@@ -172,8 +190,10 @@ class dbJournal
   // redo the transaction log
   void redo();
 
-  // undo the transaction log
-  void undo();
+  // undo the actions logged at or after savepoint, a previous size(), and
+  // drop them from the log.  If an action fails to undo, the actions after
+  // it are still dropped.
+  void undo(uint savepoint = 0);
 
   bool empty() { return _log.empty(); }
 
@@ -186,6 +186,15 @@ void dbJournalLog::pop(unsigned int& value)
   v[3] = next();
 }
 
+void dbJournalLog::popLast(uint end, unsigned int& value)
+{
+  _idx = end - sizeof(unsigned int);
+#ifdef DEBUG_JOURNAL_LOG
+  --_idx;
+#endif
+  pop(value);
+}
+
 void dbJournalLog::pop(float& value)
 {
   CHECK_TYPE(LOG_FLOAT);
@@ -60,6 +60,12 @@ class dbJournalLog
 
   bool empty() { return _data.size() == 0; }
 
+  void truncate(uint size)
+  {
+    _data.truncate(size);
+    _idx = 0;
+  }
+
   uint idx() { return _idx; }
   uint size() { return _data.size(); }
   void push(bool value);
@@ -84,6 +90,9 @@ class dbJournalLog
   void pop(double& value);
   void pop(char*& value);
   void pop(std::string& value);
+
+  // Pop the unsigned int that was the last value pushed before end.
+  void popLast(uint end, unsigned int& value);
   friend dbIStream& operator>>(dbIStream& stream, dbJournalLog& log);
   friend dbOStream& operator<<(dbOStream& stream, const dbJournalLog& log);
 };
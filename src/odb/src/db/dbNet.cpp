@@ -666,6 +666,17 @@ bool dbNet::rename(const char* name)
   if (block->_net_hash.hasMember(name))
     return false;
 
+  if (block->_journal) {
+    debugPrint(getImpl()->getLogger(),
+               utl::ODB,
+               "DB_ECO",
+               1,
+               "ECO: net {}, rename to {}",
+               getId(),
+               name);
+    block->_journal->updateField(this, _dbNet::NAME, net->_name, name);
+  }
+
   block->_net_hash.remove(net);
   free((void*) net->_name);
   net->_name = strdup(name);
@@ -1651,6 +1662,7 @@ dbSet<dbSWire> dbNet::getSWires()
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureWires();
   return dbSet<dbSWire>(net, block->_swire_itr);
 }
 dbSWire*  // Dimitris 9/11/07
@@ -1658,6 +1670,7 @@ dbNet::getFirstSWire()
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureWires();
 
   if (net->_swires == 0)
     return nullptr;
@@ -1669,6 +1682,7 @@ dbWire* dbNet::getWire()
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureWires();
 
   if (net->_wire == 0)
     return nullptr;
@@ -1680,6 +1694,7 @@ dbWire* dbNet::getGlobalWire()
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureWires();
 
   if (net->_global_wire == 0)
     return nullptr;
@@ -1934,6 +1949,7 @@ dbSet<dbRSeg> dbNet::getRSegs()
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureParasitics();
   return dbSet<dbRSeg>(net, block->_r_seg_itr);
 }
 
@@ -2340,6 +2356,7 @@ dbSet<dbCapNode> dbNet::getCapNodes()
 {
   _dbNet* net = (_dbNet*) this;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureParasitics();
   return dbSet<dbCapNode>(net, block->_cap_node_itr);
 }
 
@@ -2766,8 +2783,8 @@ void dbNet::setNonDefaultRule(dbTechNonDefaultRule* rule)
     // block->_journal->updateField(this, _dbNet::NON_DEFAULT_RULE, prev_rule,
     // net->_non_default_rule );
     block->_journal->beginAction(dbJournal::UPDATE_FIELD);
-    block->_journal->pushParam(rule->getObjectType());
-    block->_journal->pushParam(rule->getId());
+    block->_journal->pushParam(dbNetObj);
+    block->_journal->pushParam(getId());
     block->_journal->pushParam(_dbNet::NON_DEFAULT_RULE);
     block->_journal->pushParam(prev_rule);
     block->_journal->pushParam((uint) net->_non_default_rule);
@@ -2955,6 +2972,11 @@ dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
   if (!skipExistingCheck && block->_net_hash.hasMember(name_))
     return nullptr;
 
+  _dbNet* net = block->_net_tbl->create();
+  net->_name = strdup(name_);
+  ZALLOCATED(net->_name);
+  block->_net_hash.insert(net);
+
   if (block->_journal) {
     debugPrint(block->getImpl()->getLogger(),
                utl::ODB,
@@ -2965,14 +2987,10 @@ dbNet* dbNet::create(dbBlock* block_, const char* name_, bool skipExistingCheck)
     block->_journal->beginAction(dbJournal::CREATE_OBJECT);
     block->_journal->pushParam(dbNetObj);
     block->_journal->pushParam(name_);
+    block->_journal->pushParam(net->getOID());
     block->_journal->endAction();
   }
 
-  _dbNet* net = block->_net_tbl->create();
-  net->_name = strdup(name_);
-  ZALLOCATED(net->_name);
-  block->_net_hash.insert(net);
-
   std::list<dbBlockCallBackObj*>::iterator cbitr;
   for (cbitr = block->_callbacks.begin(); cbitr != block->_callbacks.end();
        ++cbitr)
@@ -2985,6 +3003,7 @@ void dbNet::destroy(dbNet* net_)
 {
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureWires();
 
   if (net->_flags._dont_touch) {
     net->getLogger()->error(
@@ -3034,6 +3053,9 @@ void dbNet::destroy(dbNet* net_)
     block->_journal->beginAction(dbJournal::DELETE_OBJECT);
     block->_journal->pushParam(dbNetObj);
     block->_journal->pushParam(net->getId());
+    // The remaining params are only used to undo the delete.
+    block->_journal->pushParam(net->_name);
+    block->_journal->pushParam(flagsToUInt(net));
     block->_journal->endAction();
   }
 
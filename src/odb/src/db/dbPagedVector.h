@@ -87,6 +87,13 @@ class dbPagedVector
   void freeIdx(uint idx);                              // DKF - to delete
   void clear();
 
+  // Drop the items at and after size; the pages are kept for reuse.
+  void truncate(unsigned int size)
+  {
+    ZASSERT(size <= _next_idx);
+    _next_idx = size;
+  }
+
   T& operator[](unsigned int id)
   {
     ZASSERT(id < _next_idx);
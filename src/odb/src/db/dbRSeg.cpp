@@ -735,6 +735,7 @@ dbRSeg* dbRSeg::create(dbNet* net_,
 {
   _dbNet* net = (_dbNet*) net_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureParasitics();
   uint cornerCnt = block->_corners_per_block;
 
   if (block->_journal) {
@@ -950,6 +951,7 @@ dbSet<dbRSeg>::iterator dbRSeg::destroy(dbSet<dbRSeg>::iterator& itr)
 dbRSeg* dbRSeg::getRSeg(dbBlock* block_, uint dbid_)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->ensureParasitics();
   return (dbRSeg*) block->_r_seg_tbl->getPtr(dbid_);
 }
 
@@ -317,6 +317,7 @@ dbSBox* dbSBox::create(dbSWire* wire_,
 dbSBox* dbSBox::getSBox(dbBlock* block_, uint dbid_)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->ensureWires();
   return (dbSBox*) block->_sbox_tbl->getPtr(dbid_);
 }
 
@@ -234,6 +234,7 @@ dbSWire* dbSWire::create(dbNet* net_, dbWireType type, dbNet* shield_)
   _dbNet* net = (_dbNet*) net_;
   _dbNet* shield = (_dbNet*) shield_;
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureWires();
 
   _dbSWire* wire = block->_swire_tbl->create();
   wire->_flags._wire_type = type.getValue();
@@ -307,6 +308,7 @@ dbSet<dbSWire>::iterator dbSWire::destroy(dbSet<dbSWire>::iterator& itr)
 dbSWire* dbSWire::getSWire(dbBlock* block_, uint dbid_)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->ensureWires();
   return (dbSWire*) block->_swire_tbl->getPtr(dbid_);
 }
 
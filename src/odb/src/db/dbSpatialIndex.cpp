@@ -0,0 +1,413 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "dbSpatialIndex.h"
+
+#include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "db.h"
+#include "dbShape.h"
+
+namespace odb {
+
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+using bgPoint = bg::model::point<int, 2, bg::cs::cartesian>;
+using bgBox = bg::model::box<bgPoint>;
+using Value = std::pair<bgBox, dbObject*>;
+using Rtree = bgi::rtree<Value, bgi::quadratic<16>>;
+
+// Instances are kept in the tree with a null layer.
+struct dbSpatialIndex::Trees
+{
+  Rtree insts;
+  std::map<dbTechLayer*, Rtree> layers;
+  // What was inserted for each owner so it can be removed even after the
+  // owner has changed.
+  std::unordered_map<dbObject*, std::vector<std::pair<dbTechLayer*, bgBox>>>
+      entries;
+};
+
+static bgBox toBox(const Rect& rect)
+{
+  return bgBox(bgPoint(rect.xMin(), rect.yMin()),
+               bgPoint(rect.xMax(), rect.yMax()));
+}
+
+static Rect toRect(const bgBox& box)
+{
+  return Rect(bg::get<bg::min_corner, 0>(box),
+              bg::get<bg::min_corner, 1>(box),
+              bg::get<bg::max_corner, 0>(box),
+              bg::get<bg::max_corner, 1>(box));
+}
+
+// Only the routed wire of a net is indexed, not its global wire.
+static bool isIndexed(dbWire* wire)
+{
+  dbNet* net = wire->getNet();
+  return net != nullptr && net->getWire() == wire;
+}
+
+dbSpatialIndex::dbSpatialIndex(dbBlock* block)
+    : block_(block), trees_(std::make_unique<Trees>())
+{
+  build();
+  addOwner(block);
+}
+
+dbSpatialIndex::~dbSpatialIndex() = default;
+
+void dbSpatialIndex::findInsts(const Rect& area,
+                               std::vector<dbInst*>& insts) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  for (auto it = trees_->insts.qbegin(bgi::intersects(toBox(area)));
+       it != trees_->insts.qend();
+       ++it) {
+    insts.push_back(static_cast<dbInst*>(it->second));
+  }
+}
+
+void dbSpatialIndex::findShapes(dbTechLayer* layer,
+                                const Rect& area,
+                                std::vector<Shape>& shapes) const
+{
+  std::shared_lock<std::shared_mutex> lock(mutex_);
+  auto tree = trees_->layers.find(layer);
+  if (tree == trees_->layers.end()) {
+    return;
+  }
+  for (auto it = tree->second.qbegin(bgi::intersects(toBox(area)));
+       it != tree->second.qend();
+       ++it) {
+    shapes.push_back({toRect(it->first), it->second});
+  }
+}
+
+// Collects everything first so each tree can be bulk loaded, which is much
+// faster than inserting one value at a time and gives a better tree.
+void dbSpatialIndex::build()
+{
+  for (dbInst* inst : block_->getInsts()) {
+    addInst(inst);
+  }
+  for (dbBTerm* bterm : block_->getBTerms()) {
+    for (dbBPin* pin : bterm->getBPins()) {
+      addBPin(pin);
+    }
+  }
+  for (dbObstruction* obs : block_->getObstructions()) {
+    addObstruction(obs);
+  }
+  for (dbNet* net : block_->getNets()) {
+    dbWire* wire = net->getWire();
+    if (wire != nullptr) {
+      addWire(wire);
+    }
+    for (dbSWire* swire : net->getSWires()) {
+      for (dbSBox* box : swire->getWires()) {
+        addSBox(box);
+      }
+    }
+  }
+
+  std::map<dbTechLayer*, std::vector<Value>> values;
+  for (const auto& [owner, entries] : trees_->entries) {
+    for (const auto& [layer, box] : entries) {
+      values[layer].emplace_back(box, owner);
+    }
+  }
+  trees_->insts = Rtree();
+  trees_->layers.clear();
+  for (auto& [layer, layer_values] : values) {
+    Rtree tree(layer_values.begin(), layer_values.end());
+    if (layer == nullptr) {
+      trees_->insts = std::move(tree);
+    } else {
+      trees_->layers[layer] = std::move(tree);
+    }
+  }
+}
+
+void dbSpatialIndex::addInst(dbInst* inst)
+{
+  if (inst->isPlaced()) {
+    add(nullptr, inst->getBBox()->getBox(), inst);
+  }
+}
+
+void dbSpatialIndex::addBPin(dbBPin* pin)
+{
+  for (dbBox* box : pin->getBoxes()) {
+    addBox(box, pin);
+  }
+}
+
+void dbSpatialIndex::addBox(dbBox* box, dbObject* owner)
+{
+  if (box->isVia()) {
+    std::vector<dbShape> shapes;
+    box->getViaBoxes(shapes);
+    for (const dbShape& shape : shapes) {
+      add(shape.getTechLayer(), shape.getBox(), owner);
+    }
+  } else {
+    add(box->getTechLayer(), box->getBox(), owner);
+  }
+}
+
+void dbSpatialIndex::addObstruction(dbObstruction* obs)
+{
+  dbBox* box = obs->getBBox();
+  add(box->getTechLayer(), box->getBox(), obs);
+}
+
+void dbSpatialIndex::addWire(dbWire* wire)
+{
+  dbWireShapeItr itr;
+  dbShape shape;
+  std::vector<dbShape> via_boxes;
+  for (itr.begin(wire); itr.next(shape);) {
+    if (shape.isVia()) {
+      dbShape::getViaBoxes(shape, via_boxes);
+      for (const dbShape& via_box : via_boxes) {
+        add(via_box.getTechLayer(), via_box.getBox(), wire);
+      }
+    } else {
+      add(shape.getTechLayer(), shape.getBox(), wire);
+    }
+  }
+}
+
+void dbSpatialIndex::addSBox(dbSBox* box)
+{
+  addBox(box, box);
+}
+
+// During build() only the entries are recorded; the trees are bulk loaded
+// from them afterwards.
+void dbSpatialIndex::add(dbTechLayer* layer, const Rect& rect, dbObject* owner)
+{
+  const bgBox box = toBox(rect);
+  trees_->entries[owner].emplace_back(layer, box);
+  if (!hasOwner()) {
+    return;
+  }
+  if (layer == nullptr) {
+    trees_->insts.insert({box, owner});
+  } else {
+    trees_->layers[layer].insert({box, owner});
+  }
+}
+
+void dbSpatialIndex::remove(dbObject* owner)
+{
+  auto entries = trees_->entries.find(owner);
+  if (entries == trees_->entries.end()) {
+    return;
+  }
+  for (const auto& [layer, box] : entries->second) {
+    if (layer == nullptr) {
+      trees_->insts.remove({box, owner});
+    } else {
+      trees_->layers[layer].remove({box, owner});
+    }
+  }
+  trees_->entries.erase(entries);
+}
+
+void dbSpatialIndex::inDbInstCreate(dbInst* inst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  addInst(inst);
+}
+
+void dbSpatialIndex::inDbInstCreate(dbInst* inst, dbRegion* /* region */)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  addInst(inst);
+}
+
+void dbSpatialIndex::inDbInstDestroy(dbInst* inst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(inst);
+}
+
+// Called before the status changes, so the bbox is added here when the
+// instance is becoming placed.
+void dbSpatialIndex::inDbInstPlacementStatusBefore(
+    dbInst* inst,
+    const dbPlacementStatus& status)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(inst);
+  if (status.isPlaced()) {
+    add(nullptr, inst->getBBox()->getBox(), inst);
+  }
+}
+
+void dbSpatialIndex::inDbInstSwapMasterBefore(dbInst* inst,
+                                              dbMaster* /* master */)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(inst);
+}
+
+void dbSpatialIndex::inDbInstSwapMasterAfter(dbInst* inst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  addInst(inst);
+}
+
+void dbSpatialIndex::inDbPreMoveInst(dbInst* inst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(inst);
+}
+
+void dbSpatialIndex::inDbPostMoveInst(dbInst* inst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  addInst(inst);
+}
+
+void dbSpatialIndex::inDbBPinAddBox(dbBox* box)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  addBox(box, box->getBoxOwner());
+}
+
+void dbSpatialIndex::inDbBPinDestroy(dbBPin* pin)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(pin);
+}
+
+void dbSpatialIndex::inDbObstructionCreate(dbObstruction* obs)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  addObstruction(obs);
+}
+
+void dbSpatialIndex::inDbObstructionDestroy(dbObstruction* obs)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(obs);
+}
+
+void dbSpatialIndex::inDbWireDestroy(dbWire* wire)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(wire);
+}
+
+void dbSpatialIndex::inDbWirePostModify(dbWire* wire)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(wire);
+  if (isIndexed(wire)) {
+    addWire(wire);
+  }
+}
+
+void dbSpatialIndex::inDbWirePostAttach(dbWire* wire)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(wire);
+  if (isIndexed(wire)) {
+    addWire(wire);
+  }
+}
+
+void dbSpatialIndex::inDbWirePreDetach(dbWire* wire)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(wire);
+}
+
+void dbSpatialIndex::inDbWirePreAppend(dbWire* /* src */, dbWire* dst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(dst);
+}
+
+void dbSpatialIndex::inDbWirePostAppend(dbWire* /* src */, dbWire* dst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (isIndexed(dst)) {
+    addWire(dst);
+  }
+}
+
+void dbSpatialIndex::inDbWirePreCopy(dbWire* /* src */, dbWire* dst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(dst);
+}
+
+void dbSpatialIndex::inDbWirePostCopy(dbWire* /* src */, dbWire* dst)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  if (isIndexed(dst)) {
+    addWire(dst);
+  }
+}
+
+void dbSpatialIndex::inDbSWireAddSBox(dbSBox* box)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  addSBox(box);
+}
+
+void dbSpatialIndex::inDbSWireRemoveSBox(dbSBox* box)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  remove(box);
+}
+
+void dbSpatialIndex::inDbSWirePreDestroySBoxes(dbSWire* wire)
+{
+  std::unique_lock<std::shared_mutex> lock(mutex_);
+  for (dbSBox* box : wire->getWires()) {
+    remove(box);
+  }
+}
+
+}  // namespace odb
@@ -86,10 +86,16 @@ dbIStream& operator>>(dbIStream& stream, Oct& o)
   return stream;
 }
 
+// Large enough that the fwrite/read per buffer is negligible, small enough
+// to not matter for the many short streams (eco, tech only, ...).
+static constexpr size_t stream_buffer_size = 1 << 20;
+
 dbOStream::dbOStream(_dbDatabase* db, FILE* f)
+    : _buffer(stream_buffer_size), _buffer_used(0), _flushed(0)
 {
   _db = db;
   _f = f;
+  _start = ftell(f);
   _lef_dist_factor = 0.001;
   _lef_area_factor = 0.000001;
 
@@ -101,7 +107,71 @@ dbOStream::dbOStream(_dbDatabase* db, FILE* f)
   }
 }
 
-dbIStream::dbIStream(_dbDatabase* db, std::ifstream& f) : _f(f)
+dbOStream::~dbOStream()
+{
+  // Callers flush() to see errors.  This only catches streams abandoned
+  // by an exception, so the result is ignored.
+  if (_buffer_used > 0) {
+    fwrite(_buffer.data(), _buffer_used, 1, _f);
+  }
+}
+
+void dbOStream::flush()
+{
+  if (_buffer_used == 0) {
+    return;
+  }
+  const size_t size = _buffer_used;
+  _buffer_used = 0;
+  if (fwrite(_buffer.data(), size, 1, _f) != 1) {
+    write_error();
+  }
+  _flushed += size;
+}
+
+void dbOStream::write_large(const void* data, size_t size)
+{
+  flush();
+  if (size < _buffer.size()) {
+    std::memcpy(_buffer.data(), data, size);
+    _buffer_used = size;
+  } else {
+    if (fwrite(data, size, 1, _f) != 1) {
+      write_error();
+    }
+    _flushed += size;
+  }
+}
+
+uint64_t dbOStream::beginSection()
+{
+  const uint64_t mark = _flushed + _buffer_used;
+  const uint64_t size = 0;
+  *this << size;
+  return mark;
+}
+
+void dbOStream::endSection(uint64_t mark)
+{
+  const uint64_t end = _flushed + _buffer_used;
+  const uint64_t size = end - mark - sizeof(size);
+  if (mark >= _flushed) {
+    std::memcpy(_buffer.data() + (mark - _flushed), &size, sizeof(size));
+    return;
+  }
+  if (_start < 0) {
+    return;
+  }
+  flush();
+  if (fseek(_f, _start + mark, SEEK_SET) != 0
+      || fwrite(&size, sizeof(size), 1, _f) != 1
+      || fseek(_f, _start + end, SEEK_SET) != 0) {
+    write_error();
+  }
+}
+
+dbIStream::dbIStream(_dbDatabase* db, std::ifstream& f)
+    : _f(f), _buffer(stream_buffer_size), _buffer_pos(0), _buffer_end(0)
 {
   _db = db;
 
@@ -116,6 +186,66 @@ dbIStream::dbIStream(_dbDatabase* db, std::ifstream& f) : _f(f)
   }
 }
 
+dbIStream::~dbIStream()
+{
+  const size_t unread = _buffer_end - _buffer_pos;
+  if (unread > 0) {
+    _f.rdbuf()->pubseekoff(-static_cast<std::streamoff>(unread),
+                           std::ios_base::cur,
+                           std::ios_base::in);
+  }
+}
+
+uint64_t dbIStream::tell()
+{
+  const std::streamoff pos
+      = _f.rdbuf()->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+  return pos - (_buffer_end - _buffer_pos);
+}
+
+void dbIStream::skip(uint64_t size)
+{
+  const size_t avail = _buffer_end - _buffer_pos;
+  if (size <= avail) {
+    _buffer_pos += size;
+    return;
+  }
+  _buffer_pos = _buffer_end = 0;
+  const std::streamoff pos = _f.rdbuf()->pubseekoff(
+      size - avail, std::ios_base::cur, std::ios_base::in);
+  if (pos < 0) {
+    throw ZException("seek failed on database stream");
+  }
+}
+
+void dbIStream::read_large(void* data, size_t size)
+{
+  char* out = static_cast<char*>(data);
+  const size_t avail = _buffer_end - _buffer_pos;
+  std::memcpy(out, _buffer.data() + _buffer_pos, avail);
+  out += avail;
+  size -= avail;
+  _buffer_pos = _buffer_end = 0;
+
+  std::streamsize n;
+  if (size >= _buffer.size()) {
+    n = _f.rdbuf()->sgetn(out, size);
+    if (n != static_cast<std::streamsize>(size)) {
+      throw ZException(
+          "read failed on database stream; unexpected end of file");
+    }
+    return;
+  }
+  n = _f.rdbuf()->sgetn(_buffer.data(), _buffer.size());
+  if (n < static_cast<std::streamsize>(size)) {
+    throw ZException(
+        "read failed on database stream; unexpected end of file");
+  }
+  std::memcpy(out, _buffer.data(), size);
+  _buffer_pos = size;
+  _buffer_end = n;
+}
+
 std::ostream& operator<<(std::ostream& os, const Rect& box)
 {
   os << "( " << box.xMin() << " " << box.yMin() << " ) ( " << box.xMax() << " "
@@ -1843,6 +1843,7 @@ dbWire* dbWire::create(dbNet* net_, bool global_wire)
   }
 
   _dbBlock* block = (_dbBlock*) net->getOwner();
+  block->ensureWires();
   _dbWire* wire = block->_wire_tbl->create();
   wire->_net = net->getOID();
 
@@ -1862,6 +1863,7 @@ dbWire* dbWire::create(dbNet* net_, bool global_wire)
 dbWire* dbWire::create(dbBlock* block_, bool /* unused: global_wire */)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->ensureWires();
   _dbWire* wire = block->_wire_tbl->create();
   for (auto callback : block->_callbacks)
     callback->inDbWireCreate((dbWire*) wire);
@@ -1871,6 +1873,7 @@ dbWire* dbWire::create(dbBlock* block_, bool /* unused: global_wire */)
 dbWire* dbWire::getWire(dbBlock* block_, uint dbid_)
 {
   _dbBlock* block = (_dbBlock*) block_;
+  block->ensureWires();
   return (dbWire*) block->_wire_tbl->getPtr(dbid_);
 }
 
@@ -82,6 +82,11 @@ void defin::continueOnErrors()
   _reader->continueOnErrors();
 }
 
+void defin::useNetBuilderThread()
+{
+  _reader->useNetBuilderThread();
+}
+
 void defin::namesAreDBIDs()
 {
   _reader->namesAreDBIDs();
@@ -0,0 +1,397 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#include "definNetQueue.h"
+
+#include "definNet.h"
+
+namespace odb {
+
+void definNetBatch::addString(const char* str)
+{
+  _ints.push_back(_strings.size());
+  _strings.append(str);
+  _strings.push_back('\0');
+}
+
+void definNetBatch::begin(const char* name)
+{
+  _ops.push_back(BEGIN);
+  addString(name);
+}
+
+void definNetBatch::beginMustjoin(const char* iname, const char* pname)
+{
+  _ops.push_back(BEGIN_MUSTJOIN);
+  addString(iname);
+  addString(pname);
+}
+
+void definNetBatch::connection(const char* iname, const char* pname)
+{
+  _ops.push_back(CONNECTION);
+  addString(iname);
+  addString(pname);
+}
+
+void definNetBatch::nonDefaultRule(const char* rule)
+{
+  _ops.push_back(NON_DEFAULT_RULE);
+  addString(rule);
+}
+
+void definNetBatch::use(dbSigType type)
+{
+  _ops.push_back(USE);
+  _ints.push_back(type.getValue());
+}
+
+void definNetBatch::wire(dbWireType type)
+{
+  _ops.push_back(WIRE);
+  _ints.push_back(type.getValue());
+}
+
+void definNetBatch::path(const char* layer)
+{
+  _ops.push_back(PATH);
+  addString(layer);
+}
+
+void definNetBatch::pathTaper(const char* layer)
+{
+  _ops.push_back(PATH_TAPER);
+  addString(layer);
+}
+
+void definNetBatch::pathTaperRule(const char* layer, const char* rule)
+{
+  _ops.push_back(PATH_TAPER_RULE);
+  addString(layer);
+  addString(rule);
+}
+
+void definNetBatch::pathPoint(int x, int y)
+{
+  _ops.push_back(PATH_POINT);
+  _ints.push_back(x);
+  _ints.push_back(y);
+}
+
+void definNetBatch::pathPoint(int x, int y, int ext)
+{
+  _ops.push_back(PATH_POINT_EXT);
+  _ints.push_back(x);
+  _ints.push_back(y);
+  _ints.push_back(ext);
+}
+
+void definNetBatch::pathVia(const char* via)
+{
+  _ops.push_back(PATH_VIA);
+  addString(via);
+}
+
+void definNetBatch::pathVia(const char* via, dbOrientType orient)
+{
+  _ops.push_back(PATH_VIA_ORIENT);
+  addString(via);
+  _ints.push_back(orient.getValue());
+}
+
+void definNetBatch::pathRect(int deltaX1,
+                             int deltaY1,
+                             int deltaX2,
+                             int deltaY2)
+{
+  _ops.push_back(PATH_RECT);
+  _ints.push_back(deltaX1);
+  _ints.push_back(deltaY1);
+  _ints.push_back(deltaX2);
+  _ints.push_back(deltaY2);
+}
+
+void definNetBatch::pathColor(int color)
+{
+  _ops.push_back(PATH_COLOR);
+  _ints.push_back(color);
+}
+
+void definNetBatch::pathEnd()
+{
+  _ops.push_back(PATH_END);
+}
+
+void definNetBatch::wireEnd()
+{
+  _ops.push_back(WIRE_END);
+}
+
+void definNetBatch::source(dbSourceType source)
+{
+  _ops.push_back(SOURCE);
+  _ints.push_back(source.getValue());
+}
+
+void definNetBatch::weight(int weight)
+{
+  _ops.push_back(WEIGHT);
+  _ints.push_back(weight);
+}
+
+void definNetBatch::fixedbump()
+{
+  _ops.push_back(FIXEDBUMP);
+}
+
+void definNetBatch::property(const char* name, const char* value)
+{
+  _ops.push_back(PROPERTY_STRING);
+  addString(name);
+  addString(value);
+}
+
+void definNetBatch::property(const char* name, int value)
+{
+  _ops.push_back(PROPERTY_INT);
+  addString(name);
+  _ints.push_back(value);
+}
+
+void definNetBatch::property(const char* name, double value)
+{
+  _ops.push_back(PROPERTY_DOUBLE);
+  addString(name);
+  _doubles.push_back(value);
+}
+
+void definNetBatch::end()
+{
+  _ops.push_back(END);
+  ++_net_cnt;
+}
+
+void definNetBatch::replay(definNet* netR) const
+{
+  auto ints = _ints.begin();
+  auto doubles = _doubles.begin();
+  auto str = [&]() { return _strings.c_str() + *ints++; };
+
+  for (Op op : _ops) {
+    switch (op) {
+      case BEGIN:
+        netR->begin(str());
+        break;
+      case BEGIN_MUSTJOIN: {
+        const char* iname = str();
+        netR->beginMustjoin(iname, str());
+        break;
+      }
+      case CONNECTION: {
+        const char* iname = str();
+        netR->connection(iname, str());
+        break;
+      }
+      case NON_DEFAULT_RULE:
+        netR->nonDefaultRule(str());
+        break;
+      case USE:
+        netR->use(dbSigType((dbSigType::Value) *ints++));
+        break;
+      case WIRE:
+        netR->wire(dbWireType((dbWireType::Value) *ints++));
+        break;
+      case PATH:
+        netR->path(str());
+        break;
+      case PATH_TAPER:
+        netR->pathTaper(str());
+        break;
+      case PATH_TAPER_RULE: {
+        const char* layer = str();
+        netR->pathTaperRule(layer, str());
+        break;
+      }
+      case PATH_POINT: {
+        int x = *ints++;
+        int y = *ints++;
+        netR->pathPoint(x, y);
+        break;
+      }
+      case PATH_POINT_EXT: {
+        int x = *ints++;
+        int y = *ints++;
+        int ext = *ints++;
+        netR->pathPoint(x, y, ext);
+        break;
+      }
+      case PATH_VIA:
+        netR->pathVia(str());
+        break;
+      case PATH_VIA_ORIENT: {
+        const char* via = str();
+        netR->pathVia(via, dbOrientType((dbOrientType::Value) *ints++));
+        break;
+      }
+      case PATH_RECT: {
+        int deltaX1 = *ints++;
+        int deltaY1 = *ints++;
+        int deltaX2 = *ints++;
+        int deltaY2 = *ints++;
+        netR->pathRect(deltaX1, deltaY1, deltaX2, deltaY2);
+        break;
+      }
+      case PATH_COLOR:
+        netR->pathColor(*ints++);
+        break;
+      case PATH_END:
+        netR->pathEnd();
+        break;
+      case WIRE_END:
+        netR->wireEnd();
+        break;
+      case SOURCE:
+        netR->source(dbSourceType((dbSourceType::Value) *ints++));
+        break;
+      case WEIGHT:
+        netR->weight(*ints++);
+        break;
+      case FIXEDBUMP:
+        netR->fixedbump();
+        break;
+      case PROPERTY_STRING: {
+        const char* name = str();
+        netR->property(name, str());
+        break;
+      }
+      case PROPERTY_INT: {
+        const char* name = str();
+        netR->property(name, *ints++);
+        break;
+      }
+      case PROPERTY_DOUBLE: {
+        const char* name = str();
+        netR->property(name, *doubles++);
+        break;
+      }
+      case END:
+        netR->end();
+        break;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////
+
+definNetQueue::definNetQueue(definNet* netR)
+    : _netR(netR), _batch(std::make_unique<definNetBatch>()), _done(false)
+{
+  _builder = std::thread(&definNetQueue::run, this);
+}
+
+definNetQueue::~definNetQueue()
+{
+  if (_builder.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _done = true;
+    }
+    _not_empty.notify_one();
+    _builder.join();
+  }
+}
+
+void definNetQueue::netEnd()
+{
+  if (_batch->netCount() >= _batch_size) {
+    push(std::move(_batch));
+    _batch = std::make_unique<definNetBatch>();
+  }
+}
+
+void definNetQueue::push(std::unique_ptr<definNetBatch> batch)
+{
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _not_full.wait(lock, [this] { return _queue.size() < _max_queued; });
+    _queue.push_back(std::move(batch));
+  }
+  _not_empty.notify_one();
+}
+
+void definNetQueue::finish()
+{
+  if (!_builder.joinable()) {
+    return;
+  }
+  push(std::move(_batch));
+  _batch = std::make_unique<definNetBatch>();
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _done = true;
+  }
+  _not_empty.notify_one();
+  _builder.join();
+
+  if (_error) {
+    std::rethrow_exception(_error);
+  }
+}
+
+void definNetQueue::run()
+{
+  for (;;) {
+    std::unique_ptr<definNetBatch> batch;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _not_empty.wait(lock, [this] { return !_queue.empty() || _done; });
+      if (_queue.empty()) {
+        return;
+      }
+      batch = std::move(_queue.front());
+      _queue.pop_front();
+    }
+    _not_full.notify_one();
+
+    // After a failure keep draining so the parser never blocks on a full
+    // queue; the error is reported from finish().
+    if (!_error) {
+      try {
+        batch->replay(_netR);
+      } catch (...) {
+        _error = std::current_exception();
+      }
+    }
+  }
+}
+
+}  // namespace odb
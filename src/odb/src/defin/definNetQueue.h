@@ -0,0 +1,166 @@
+///////////////////////////////////////////////////////////////////////////////
+// BSD 3-Clause License
+//
+// Copyright (c) 2024, The Regents of the University of California
+// All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice, this
+//   list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from
+//   this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "dbTypes.h"
+#include "odb.h"
+
+namespace odb {
+
+class definNet;
+
+// Records the definNet calls made for a run of nets so they can be replayed
+// later, possibly on another thread.  The interface mirrors the subset of
+// definNet used by the parser callback so either can be driven by it.
+class definNetBatch
+{
+ public:
+  void begin(const char* name);
+  void beginMustjoin(const char* iname, const char* pname);
+  void connection(const char* iname, const char* pname);
+  void nonDefaultRule(const char* rule);
+  void use(dbSigType type);
+  void wire(dbWireType type);
+  void path(const char* layer);
+  void pathTaper(const char* layer);
+  void pathTaperRule(const char* layer, const char* rule);
+  void pathPoint(int x, int y);
+  void pathPoint(int x, int y, int ext);
+  void pathVia(const char* via);
+  void pathVia(const char* via, dbOrientType orient);
+  void pathRect(int deltaX1, int deltaY1, int deltaX2, int deltaY2);
+  void pathColor(int color);
+  void pathEnd();
+  void wireEnd();
+  void source(dbSourceType source);
+  void weight(int weight);
+  void fixedbump();
+  void property(const char* name, const char* value);
+  void property(const char* name, int value);
+  void property(const char* name, double value);
+  void end();
+
+  int netCount() const { return _net_cnt; }
+
+  // Issue the recorded calls, in order, on netR.
+  void replay(definNet* netR) const;
+
+ private:
+  enum Op : unsigned char
+  {
+    BEGIN,
+    BEGIN_MUSTJOIN,
+    CONNECTION,
+    NON_DEFAULT_RULE,
+    USE,
+    WIRE,
+    PATH,
+    PATH_TAPER,
+    PATH_TAPER_RULE,
+    PATH_POINT,
+    PATH_POINT_EXT,
+    PATH_VIA,
+    PATH_VIA_ORIENT,
+    PATH_RECT,
+    PATH_COLOR,
+    PATH_END,
+    WIRE_END,
+    SOURCE,
+    WEIGHT,
+    FIXEDBUMP,
+    PROPERTY_STRING,
+    PROPERTY_INT,
+    PROPERTY_DOUBLE,
+    END
+  };
+
+  void addString(const char* str);
+
+  // Strings are kept null terminated in one buffer and referenced by offset
+  // from _ints to avoid an allocation per name.
+  std::vector<Op> _ops;
+  std::vector<int> _ints;
+  std::vector<double> _doubles;
+  std::string _strings;
+  int _net_cnt = 0;
+};
+
+// Overlaps parsing of the NETS section with construction of the nets in the
+// block.  The Si2 parser is not reentrant so it stays on the calling thread
+// and records nets into batches; a single builder thread replays the batches
+// in file order on definNet.  The block is therefore only ever modified by
+// one thread and comes out identical to a serial read.
+class definNetQueue
+{
+ public:
+  explicit definNetQueue(definNet* netR);
+  ~definNetQueue();
+
+  // Batch the parser should record the current net into.
+  definNetBatch* batch() { return _batch.get(); }
+
+  // Called after each net; hands the batch to the builder once it is full.
+  void netEnd();
+
+  // Flush the partial batch and wait for the builder to drain the queue.
+  // Rethrows any exception raised while building.
+  void finish();
+
+ private:
+  void push(std::unique_ptr<definNetBatch> batch);
+  void run();
+
+  static constexpr int _batch_size = 1024;
+  static constexpr int _max_queued = 8;
+
+  definNet* _netR;
+  std::unique_ptr<definNetBatch> _batch;
+  std::deque<std::unique_ptr<definNetBatch>> _queue;
+  std::mutex _mutex;
+  std::condition_variable _not_empty;
+  std::condition_variable _not_full;
+  bool _done;
+  std::exception_ptr _error;
+  std::thread _builder;
+};
+
+}  // namespace odb
@@ -47,6 +47,7 @@
 #include "definGCell.h"
 #include "definGroup.h"
 #include "definNet.h"
+#include "definNetQueue.h"
 #include "definNonDefaultRule.h"
 #include "definPin.h"
 #include "definPinProps.h"
@@ -78,6 +79,7 @@ definReader::definReader(dbDatabase* db, utl::Logger* logger, defin::MODE mode)
   _block_name = nullptr;
   parent_ = nullptr;
   _continue_on_errors = false;
+  _net_builder_thread = false;
   version_ = nullptr;
   hier_delimeter_ = 0;
   left_bus_delimeter_ = 0;
@@ -124,6 +126,9 @@ definReader::definReader(dbDatabase* db, utl::Logger* logger, defin::MODE mode)
 
 definReader::~definReader()
 {
+  // A parse abandoned mid NETS section leaves the builder thread running
+  // against _netR; join it before _netR goes away.
+  _net_queue.reset();
   delete _blockageR;
   delete _componentR;
   delete _componentMaskShift;
@@ -189,6 +194,11 @@ void definReader::continueOnErrors()
   _continue_on_errors = true;
 }
 
+void definReader::useNetBuilderThread()
+{
+  _net_builder_thread = true;
+}
+
 void definReader::replaceWires()
 {
   _netR->replaceWires();
@@ -698,7 +708,6 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
 {
   definReader* reader = (definReader*) data;
   CHECKBLOCK
-  definNet* netR = reader->_netR;
   if (reader->_mode == defin::FLOORPLAN
       && reader->_block->findNet(net->name()) == nullptr) {
     reader->_logger->warn(
@@ -708,6 +717,22 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
         net->name());
     return PARSE_OK;
   }
+
+  if (reader->_net_builder_thread && reader->_mode == defin::DEFAULT) {
+    if (!reader->_net_queue) {
+      reader->_net_queue = std::make_unique<definNetQueue>(reader->_netR);
+    }
+    int status = addNet(reader, net, reader->_net_queue->batch());
+    reader->_net_queue->netEnd();
+    return status;
+  }
+
+  return addNet(reader, net, reader->_netR);
+}
+
+template <typename NET_R>
+int definReader::addNet(definReader* reader, defiNet* net, NET_R* netR)
+{
   if (net->numShieldNets() > 0) {
     UNSUPPORTED("SHIELDNET on net is unsupported");
   }
@@ -875,6 +900,23 @@ int definReader::netCallback(defrCallbackType_e /* unused: type */,
   return PARSE_OK;
 }
 
+int definReader::netsEndCallback(defrCallbackType_e /* unused: type */,
+                                 void* /* unused: ptr */,
+                                 defiUserData data)
+{
+  definReader* reader = (definReader*) data;
+  reader->finishNets();
+  return PARSE_OK;
+}
+
+void definReader::finishNets()
+{
+  if (_net_queue) {
+    std::unique_ptr<definNetQueue> queue = std::move(_net_queue);
+    queue->finish();
+  }
+}
+
 int definReader::nonDefaultRuleCallback(defrCallbackType_e /* unused: type */,
                                         defiNonDefault* rule,
                                         defiUserData data)
@@ -1804,6 +1846,7 @@ bool definReader::createBlock(const char* file)
     defrSetTrackCbk(trackCallback);
     defrSetRowCbk(rowCallback);
     defrSetNetCbk(netCallback);
+    defrSetNetEndCbk(netsEndCallback);
     defrSetSNetCbk(specialNetCallback);
     defrSetViaCbk(viaCallback);
     defrSetBlockageCbk(blockageCallback);
@@ -1857,6 +1900,7 @@ bool definReader::createBlock(const char* file)
     res = defrReadGZip(f, file, (defiUserData) this);
     defGZipClose(f);
   }
+  finishNets();
 
   if (res != 0 || errors() != 0) {
     if (!_continue_on_errors) {
@@ -1889,11 +1933,13 @@ bool definReader::replaceWires(const char* file)
   defrInitSession();
 
   defrSetNetCbk(netCallback);
+  defrSetNetEndCbk(netsEndCallback);
   defrSetSNetCbk(specialNetCallback);
 
   defrSetAddPathToNet();
 
   int res = defrRead(f, file, (defiUserData) this, /* case sensitive */ 1);
+  finishNets();
   if (res != 0) {
     if (!_continue_on_errors) {
       _logger->error(utl::ODB, 422, "DEF parser returns an error!");
@@ -32,6 +32,8 @@
 
 #pragma once
 
+#include <memory>
+
 #include "definBase.h"
 #include "defrReader.hpp"
 #include "odb.h"
@@ -48,6 +50,7 @@ class definComponent;
 class definFill;
 class definGCell;
 class definNet;
+class definNetQueue;
 class definPin;
 class definRow;
 class definSNet;
@@ -82,6 +85,8 @@ class definReader : public definBase
   std::vector<definBase*> _interfaces;
   bool _update;
   bool _continue_on_errors;
+  bool _net_builder_thread;
+  std::unique_ptr<definNetQueue> _net_queue;
   const char* _block_name;
   const char* version_;
   char hier_delimeter_;
@@ -102,6 +107,7 @@ class definReader : public definBase
   bool replaceWires(const char* file);
   void replaceWires();
   int errors();
+  void finishNets();
 
   // Parser callbacks
   static int blockageCallback(defrCallbackType_e type,
@@ -155,6 +161,11 @@ class definReader : public definBase
   static int netCallback(defrCallbackType_e type,
                          defiNet* net,
                          defiUserData data);
+  static int netsEndCallback(defrCallbackType_e type,
+                             void* v,
+                             defiUserData data);
+  template <typename NET_R>
+  static int addNet(definReader* reader, defiNet* net, NET_R* netR);
 
   static int nonDefaultRuleCallback(defrCallbackType_e type,
                                     defiNonDefault* rule,
@@ -255,6 +266,7 @@ class definReader : public definBase
   void skipBlockWires();
   void skipFillWires();
   void continueOnErrors();
+  void useNetBuilderThread();
   void useBlockName(const char* name);
   void namesAreDBIDs();
   void setAssemblyMode();
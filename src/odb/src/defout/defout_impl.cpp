@@ -35,11 +35,15 @@
 #include <stdio.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
 #include <limits>
+#include <mutex>
 #include <optional>
 #include <set>
 #include <string>
+#include <thread>
 
 #include "odb/db.h"
 #include "odb/dbMap.h"
@@ -145,25 +149,10 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
 
   _dist_factor
       = (double) block->getDefUnits() / (double) block->getDbUnitsPerMicron();
-  _out = fopen(def_file, "w");
-
-  if (_out == nullptr) {
-    _logger->warn(
-        utl::ODB, 172, "Cannot open DEF file ({}) for writing", def_file);
+  if (!openOutput(def_file)) {
     return false;
   }
 
-  // By default C File*'s are line buffered which means they get dumped on every
-  // newline, which is nominally pretty expensive. This makes it so that the
-  // writes are buffered according to the block size which on modern systems can
-  // be as much as 16kb. DEF's have a lot of newlines, and are large in size
-  // which makes writing them really slow with line buffering.
-  //
-  // The following lines enable IO buffering based on disk block size.
-  struct stat stats;
-  fstat(fileno(_out), &stats);
-  setvbuf(_out, nullptr, _IOFBF, stats.st_blksize);
-
   if (_version == defout::DEF_5_3) {
     fprintf(_out, "VERSION 5.3 ;\n");
   } else if (_version == defout::DEF_5_4) {
@@ -223,16 +212,19 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
   if (_version == defout::DEF_5_8) {
     writeComponentMaskShift(block);
   }
+  flushStaged();
   writeInsts(block);
   writeBTerms(block);
   writePinProperties(block);
+  flushStaged();
   writeBlockages(block);
   writeFills(block);
+  flushStaged();
   writeNets(block);
   writeGroups(block);
 
   fprintf(_out, "END DESIGN\n");
-  fclose(_out);
+  closeOutput();
   if (_select_net_map)
     delete _select_net_map;
   if (_select_inst_map)
@@ -240,6 +232,182 @@ bool defout_impl::writeBlock(dbBlock* block, const char* def_file)
   return true;
 }
 
+static bool hasSuffix(const std::string& str, const std::string& suffix)
+{
+  return str.size() >= suffix.size()
+         && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+bool defout_impl::openOutput(const char* def_file)
+{
+  if (hasSuffix(def_file, ".gz")) {
+    _gz_out = gzopen(def_file, "wb");
+    if (_gz_out == nullptr) {
+      _logger->warn(
+          utl::ODB, 172, "Cannot open DEF file ({}) for writing", def_file);
+      return false;
+    }
+    _out = open_memstream(&_staged, &_staged_size);
+    return true;
+  }
+
+  _out = fopen(def_file, "w");
+
+  if (_out == nullptr) {
+    _logger->warn(
+        utl::ODB, 172, "Cannot open DEF file ({}) for writing", def_file);
+    return false;
+  }
+
+  // By default C File*'s are line buffered which means they get dumped on every
+  // newline, which is nominally pretty expensive. This makes it so that the
+  // writes are buffered according to the block size which on modern systems can
+  // be as much as 16kb. DEF's have a lot of newlines, and are large in size
+  // which makes writing them really slow with line buffering.
+  //
+  // The following lines enable IO buffering based on disk block size.
+  struct stat stats;
+  fstat(fileno(_out), &stats);
+  setvbuf(_out, nullptr, _IOFBF, stats.st_blksize);
+  return true;
+}
+
+void defout_impl::closeOutput()
+{
+  if (_gz_out) {
+    flushStaged();
+    fclose(_out);
+    free(_staged);
+    gzclose(_gz_out);
+    _gz_out = nullptr;
+  } else {
+    fclose(_out);
+  }
+  _out = nullptr;
+  _staged = nullptr;
+  _staged_size = 0;
+}
+
+// Compress whatever has been staged so far and start a new staging buffer.
+// A no-op when writing plain text.
+void defout_impl::flushStaged()
+{
+  if (_gz_out == nullptr) {
+    return;
+  }
+  fclose(_out);
+  if (_staged_size > 0) {
+    gzwrite(_gz_out, _staged, _staged_size);
+  }
+  free(_staged);
+  _out = open_memstream(&_staged, &_staged_size);
+}
+
+void defout_impl::writeBuffer(const char* data, size_t size)
+{
+  if (_gz_out) {
+    flushStaged();
+    gzwrite(_gz_out, data, size);
+  } else {
+    fwrite(data, 1, size, _out);
+  }
+}
+
+// Write each object with the given member function.  With more than one
+// thread, runs of chunk_size objects are formatted into separate in-memory
+// streams by copies of this writer and then written out in order as they
+// complete, so the output is the same as a serial write.
+template <typename T>
+void defout_impl::writeObjects(const std::vector<T*>& objects,
+                               void (defout_impl::*write)(T*),
+                               int chunk_size)
+{
+  const size_t chunk_cnt = (objects.size() + chunk_size - 1) / chunk_size;
+
+  if (_num_threads <= 1 || chunk_cnt <= 1) {
+    for (size_t i = 0; i < objects.size(); ++i) {
+      (this->*write)(objects[i]);
+      if ((i + 1) % chunk_size == 0) {
+        flushStaged();
+      }
+    }
+    return;
+  }
+
+  struct Chunk
+  {
+    char* data = nullptr;
+    size_t size = 0;
+    bool ready = false;
+  };
+  std::vector<Chunk> chunks(chunk_cnt);
+  // Bound how far the workers may run ahead of the output to limit memory.
+  const size_t window = 4 * _num_threads;
+  size_t next_chunk = 0;
+  size_t written = 0;
+  std::mutex mutex;
+  std::condition_variable changed;
+
+  auto worker = [&]() {
+    defout_impl writer(*this);
+    writer._gz_out = nullptr;
+    for (;;) {
+      size_t chunk;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&] {
+          return next_chunk >= chunk_cnt || next_chunk < written + window;
+        });
+        if (next_chunk >= chunk_cnt) {
+          return;
+        }
+        chunk = next_chunk++;
+      }
+
+      char* data;
+      size_t size;
+      writer._out = open_memstream(&data, &size);
+      const size_t end
+          = std::min(objects.size(), (chunk + 1) * (size_t) chunk_size);
+      for (size_t i = chunk * chunk_size; i < end; ++i) {
+        (writer.*write)(objects[i]);
+      }
+      fclose(writer._out);
+
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        chunks[chunk] = {data, size, true};
+      }
+      changed.notify_all();
+    }
+  };
+
+  const int thread_cnt = std::min((size_t) _num_threads, chunk_cnt);
+  std::vector<std::thread> threads;
+  threads.reserve(thread_cnt);
+  for (int i = 0; i < thread_cnt; ++i) {
+    threads.emplace_back(worker);
+  }
+
+  for (Chunk& chunk : chunks) {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      changed.wait(lock, [&] { return chunk.ready; });
+    }
+    writeBuffer(chunk.data, chunk.size);
+    free(chunk.data);
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      ++written;
+    }
+    changed.notify_all();
+  }
+
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
 void defout_impl::writeRows(dbBlock* block)
 {
   dbSet<dbRow> rows = block->getRows();
@@ -493,11 +661,13 @@ void defout_impl::writeInsts(dbBlock* block)
   fprintf(_out, "COMPONENTS %u ;\n", insts.size());
 
   // Sort the components for consistent output
+  std::vector<dbInst*> selected;
   for (dbInst* inst : sortedSet(insts)) {
     if (_select_inst_map && !(*_select_inst_map)[inst])
       continue;
-    writeInst(inst);
+    selected.push_back(inst);
   }
+  writeObjects(selected, &defout_impl::writeInst, 1024);
 
   fprintf(_out, "END COMPONENTS\n");
 }
@@ -1295,25 +1465,30 @@ void defout_impl::writeNets(dbBlock* block)
   if (snet_cnt > 0) {
     fprintf(_out, "SPECIALNETS %d ;\n", snet_cnt);
 
+    // Special nets are few but can carry a whole power grid each.
+    std::vector<dbNet*> snets;
     for (dbNet* net : sorted_nets) {
       if (_select_net_map && !(*_select_net_map)[net])
         continue;
       if (net->isSpecial())
-        writeSNet(net);
+        snets.push_back(net);
     }
+    writeObjects(snets, &defout_impl::writeSNet, 1);
 
     fprintf(_out, "END SPECIALNETS\n");
   }
 
   fprintf(_out, "NETS %d ;\n", net_cnt);
 
+  std::vector<dbNet*> nets_to_write;
   for (dbNet* net : sorted_nets) {
     if (_select_net_map && !(*_select_net_map)[net])
       continue;
 
     if (regular_net[net] == 1)
-      writeNet(net);
+      nets_to_write.push_back(net);
   }
+  writeObjects(nets_to_write, &defout_impl::writeNet, 256);
 
   fprintf(_out, "END NETS\n");
 }
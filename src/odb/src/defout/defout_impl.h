@@ -32,9 +32,12 @@
 
 #pragma once
 
+#include <zlib.h>
+
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "odb/db.h"
 #include "odb/dbMap.h"
@@ -69,6 +72,12 @@ class defout_impl
 
   double _dist_factor;
   FILE* _out;
+  // With gzip output, _out stages text in memory which is compressed into
+  // _gz_out section by section.
+  gzFile _gz_out;
+  char* _staged;
+  size_t _staged_size;
+  int _num_threads;
   bool _use_net_inst_ids;
   bool _use_master_ids;
   bool _use_alias;
@@ -115,6 +124,15 @@ class defout_impl
   void writePinProperties(dbBlock* block);
   bool hasProperties(dbObject* object, ObjType type);
 
+  bool openOutput(const char* def_file);
+  void closeOutput();
+  void flushStaged();
+  void writeBuffer(const char* data, size_t size);
+  template <typename T>
+  void writeObjects(const std::vector<T*>& objects,
+                    void (defout_impl::*write)(T*),
+                    int chunk_size);
+
  public:
   defout_impl(utl::Logger* logger)
   {
@@ -125,6 +143,11 @@ class defout_impl
     _select_inst_map = nullptr;
     _version = defout::DEF_5_8;
     _logger = logger;
+    _out = nullptr;
+    _gz_out = nullptr;
+    _staged = nullptr;
+    _staged_size = 0;
+    _num_threads = 1;
   }
 
   ~defout_impl() {}
@@ -139,6 +162,7 @@ class defout_impl
 
   void selectInst(dbInst* inst);
   void setVersion(int v) { _version = v; }
+  void setNumThreads(int threads) { _num_threads = threads; }
 
   bool writeBlock(dbBlock* block, const char* def_file);
 };
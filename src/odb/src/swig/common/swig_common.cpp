@@ -177,6 +177,8 @@ odb::dbDatabase* read_db(odb::dbDatabase* db, const char* db_path)
 
 int write_db(odb::dbDatabase* db, const char* db_path)
 {
+  // db_path may be the file a lazy read is still loading from.
+  db->loadLazySections();
   FILE* fp = fopen(db_path, "wb");
   if (!fp) {
     int errnum = errno;
@@ -0,0 +1,162 @@
+// Copyright 2024 The Regents of the University of California
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "odb/db.h"
+
+namespace odb {
+namespace {
+
+template <class T>
+using OdbUniquePtr = std::unique_ptr<T, void (*)(T*)>;
+
+OdbUniquePtr<dbDatabase> createDb()
+{
+  return OdbUniquePtr<dbDatabase>(dbDatabase::create(), &dbDatabase::destroy);
+}
+
+std::ifstream openForRead(const std::string& path)
+{
+  std::ifstream file;
+  file.exceptions(std::ifstream::failbit | std::ifstream::badbit
+                  | std::ios::eofbit);
+  file.open(path, std::ios::binary);
+  return file;
+}
+
+// Enough nets that the block spans several stream buffers.
+TEST(DbStream, RoundTripsLargeBlock)
+{
+  auto db = createDb();
+  dbTech* tech = dbTech::create(db.get(), "tech");
+  dbTechLayer::create(tech, "m1", dbTechLayerType::ROUTING);
+  dbChip* chip = dbChip::create(db.get());
+  dbBlock* block = dbBlock::create(chip, "top", tech);
+  const int num_nets = 100000;
+  for (int i = 0; i < num_nets; i++) {
+    const std::string name = "a_fairly_long_net_name_" + std::to_string(i);
+    dbNet::create(block, name.c_str());
+  }
+
+  const std::string path = testing::TempDir() + "large_block.odb";
+  FILE* out = fopen(path.c_str(), "w");
+  ASSERT_NE(out, nullptr);
+  db->write(out);
+  fclose(out);
+
+  auto db2 = createDb();
+  std::ifstream in = openForRead(path);
+  db2->read(in);
+  dbBlock* block2 = db2->getChip()->getBlock();
+  ASSERT_NE(block2, nullptr);
+  EXPECT_EQ(block2->getNets().size(), num_nets);
+  EXPECT_NE(block2->findNet("a_fairly_long_net_name_0"), nullptr);
+  EXPECT_NE(block2->findNet("a_fairly_long_net_name_99999"), nullptr);
+  std::remove(path.c_str());
+}
+
+// Each read stream must give back what it buffered past its own data.
+TEST(DbStream, ReadsConsecutiveSectionsOfOneFile)
+{
+  auto db = createDb();
+  dbTech* tech = dbTech::create(db.get(), "tech");
+  dbTechLayer::create(tech, "m1", dbTechLayerType::ROUTING);
+  dbTechLayer::create(tech, "m2", dbTechLayerType::ROUTING);
+  dbLib::create(db.get(), "lib", tech);
+
+  const std::string path = testing::TempDir() + "sections.odb";
+  FILE* out = fopen(path.c_str(), "w");
+  ASSERT_NE(out, nullptr);
+  db->writeTech(out);
+  db->writeLibs(out);
+  fclose(out);
+
+  auto db2 = createDb();
+  std::ifstream in = openForRead(path);
+  db2->readTech(in);
+  db2->readLibs(in);
+  ASSERT_NE(db2->getTech(), nullptr);
+  EXPECT_EQ(db2->getTech()->getLayers().size(), 2);
+  EXPECT_NE(db2->findLib("lib"), nullptr);
+  std::remove(path.c_str());
+}
+
+// The special wires stay on disk until first used and survive writing the
+// database back over the file they are loaded from.
+TEST(DbStream, LazyReadLoadsWiresOnFirstUse)
+{
+  auto db = createDb();
+  dbTech* tech = dbTech::create(db.get(), "tech");
+  dbTechLayer* m1 = dbTechLayer::create(tech, "m1", dbTechLayerType::ROUTING);
+  dbChip* chip = dbChip::create(db.get());
+  dbBlock* block = dbBlock::create(chip, "top", tech);
+  dbNet* vdd = dbNet::create(block, "VDD");
+  dbSWire* swire = dbSWire::create(vdd, dbWireType::ROUTED);
+  dbSBox::create(swire, m1, 0, 0, 1000, 100, dbWireShapeType::STRIPE);
+
+  const std::string path = testing::TempDir() + "lazy.odb";
+  FILE* out = fopen(path.c_str(), "w");
+  ASSERT_NE(out, nullptr);
+  db->write(out);
+  fclose(out);
+
+  for (int pass = 0; pass < 2; pass++) {
+    auto db2 = createDb();
+    db2->readLazy(path.c_str());
+    dbNet* vdd2 = db2->getChip()->getBlock()->findNet("VDD");
+    ASSERT_NE(vdd2, nullptr);
+    ASSERT_EQ(vdd2->getSWires().size(), 1);
+    dbSet<dbSBox> boxes = (*vdd2->getSWires().begin())->getWires();
+    ASSERT_EQ(boxes.size(), 1);
+    EXPECT_EQ((*boxes.begin())->getBox(), Rect(0, 0, 1000, 100));
+
+    db2->loadLazySections();
+    out = fopen(path.c_str(), "w");
+    ASSERT_NE(out, nullptr);
+    db2->write(out);
+    fclose(out);
+  }
+  std::remove(path.c_str());
+}
+
+// A lazy read by relative path still finds its file after a cd.
+TEST(DbStream, LazyReadSurvivesChdir)
+{
+  auto db = createDb();
+  dbTech* tech = dbTech::create(db.get(), "tech");
+  dbTechLayer* m1 = dbTechLayer::create(tech, "m1", dbTechLayerType::ROUTING);
+  dbChip* chip = dbChip::create(db.get());
+  dbBlock* block = dbBlock::create(chip, "top", tech);
+  dbNet* vdd = dbNet::create(block, "VDD");
+  dbSWire* swire = dbSWire::create(vdd, dbWireType::ROUTED);
+  dbSBox::create(swire, m1, 0, 0, 1000, 100, dbWireShapeType::STRIPE);
+
+  const std::filesystem::path cwd = std::filesystem::current_path();
+  std::filesystem::current_path(testing::TempDir());
+  FILE* out = fopen("lazy_chdir.odb", "w");
+  ASSERT_NE(out, nullptr);
+  db->write(out);
+  fclose(out);
+
+  auto db2 = createDb();
+  db2->readLazy("lazy_chdir.odb");
+  std::filesystem::current_path(cwd);
+
+  dbNet* vdd2 = db2->getChip()->getBlock()->findNet("VDD");
+  ASSERT_NE(vdd2, nullptr);
+  ASSERT_EQ(vdd2->getSWires().size(), 1);
+  EXPECT_EQ((*vdd2->getSWires().begin())->getWires().size(), 1);
+  std::remove((testing::TempDir() + "lazy_chdir.odb").c_str());
+}
+
+}  // namespace
+}  // namespace odb
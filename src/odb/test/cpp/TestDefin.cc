@@ -0,0 +1,58 @@
+// Copyright 2024 The Regents of the University of California
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/lefin.h"
+#include "utl/Logger.h"
+
+namespace odb {
+namespace {
+
+std::string readDesign(utl::Logger* logger, bool net_builder_thread)
+{
+  dbDatabase* db = dbDatabase::create();
+  lefin lef_reader(db, logger, /*ignore_non_routing_layers=*/false);
+  dbLib* lib = lef_reader.createTechAndLib(
+      "tech", "lib", "data/Nangate45/NangateOpenCellLibrary.mod.lef");
+
+  defin def_reader(db, logger);
+  if (net_builder_thread) {
+    def_reader.useNetBuilderThread();
+  }
+  std::vector<dbLib*> libs = {lib};
+  dbChip* chip = def_reader.createChip(
+      libs, "data/gcd/gcd_nangate45_route.def", lib->getTech());
+  EXPECT_NE(chip, nullptr);
+
+  FILE* file = tmpfile();
+  db->write(file);
+  dbDatabase::destroy(db);
+
+  std::string bytes(ftell(file), '\0');
+  rewind(file);
+  EXPECT_EQ(fread(bytes.data(), 1, bytes.size(), file), bytes.size());
+  fclose(file);
+  return bytes;
+}
+
+TEST(Defin, NetBuilderThreadMatchesSerialRead)
+{
+  utl::Logger logger;
+  const std::string serial = readDesign(&logger, false);
+  const std::string threaded = readDesign(&logger, true);
+
+  EXPECT_FALSE(serial.empty());
+  EXPECT_TRUE(serial == threaded);
+}
+
+}  // namespace
+}  // namespace odb
@@ -0,0 +1,84 @@
+// Copyright 2024 The Regents of the University of California
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include <unistd.h>
+#include <zlib.h>
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/defin.h"
+#include "odb/defout.h"
+#include "odb/lefin.h"
+#include "utl/Logger.h"
+
+namespace odb {
+namespace {
+
+class DefoutTest : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    db_ = dbDatabase::create();
+    lefin lef_reader(db_, &logger_, /*ignore_non_routing_layers=*/false);
+    dbLib* lib = lef_reader.createTechAndLib(
+        "tech", "lib", "data/Nangate45/NangateOpenCellLibrary.mod.lef");
+
+    defin def_reader(db_, &logger_);
+    std::vector<dbLib*> libs = {lib};
+    dbChip* chip = def_reader.createChip(
+        libs, "data/gcd/gcd_nangate45_route.def", lib->getTech());
+    block_ = chip->getBlock();
+  }
+
+  void TearDown() override { dbDatabase::destroy(db_); }
+
+  std::string writeDef(const std::string& name, int threads)
+  {
+    const std::string file_name = testing::TempDir() + name;
+    defout writer(&logger_);
+    writer.setNumThreads(threads);
+    EXPECT_TRUE(writer.writeBlock(block_, file_name.c_str()));
+
+    std::string text;
+    gzFile file = gzopen(file_name.c_str(), "rb");
+    char buffer[4096];
+    int size;
+    while ((size = gzread(file, buffer, sizeof(buffer))) > 0) {
+      text.append(buffer, size);
+    }
+    gzclose(file);
+    unlink(file_name.c_str());
+    return text;
+  }
+
+  utl::Logger logger_;
+  dbDatabase* db_ = nullptr;
+  dbBlock* block_ = nullptr;
+};
+
+TEST_F(DefoutTest, ThreadedWriteMatchesSerialWrite)
+{
+  const std::string serial = writeDef("defout_serial.def", 1);
+  const std::string threaded = writeDef("defout_threaded.def", 4);
+
+  EXPECT_FALSE(serial.empty());
+  EXPECT_TRUE(serial == threaded);
+}
+
+TEST_F(DefoutTest, GzipWriteMatchesPlainWrite)
+{
+  const std::string plain = writeDef("defout_plain.def", 1);
+  const std::string gzip = writeDef("defout_gzip.def.gz", 4);
+
+  EXPECT_TRUE(plain == gzip);
+}
+
+}  // namespace
+}  // namespace odb
@@ -0,0 +1,108 @@
+// Copyright 2024 The Regents of the University of California
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/dbSpatialIndex.h"
+
+namespace odb {
+namespace {
+
+class SpatialIndexTest : public testing::Test
+{
+ protected:
+  SpatialIndexTest() : db_(dbDatabase::create(), &dbDatabase::destroy)
+  {
+    dbTech* tech = dbTech::create(db_.get(), "tech");
+    m1_ = dbTechLayer::create(tech, "m1", dbTechLayerType::ROUTING);
+    dbLib* lib = dbLib::create(db_.get(), "lib", tech);
+    master_ = dbMaster::create(lib, "cell");
+    master_->setWidth(100);
+    master_->setHeight(100);
+    master_->setType(dbMasterType::CORE);
+    master_->setFrozen();
+    dbChip* chip = dbChip::create(db_.get());
+    block_ = dbBlock::create(chip, "top", tech);
+  }
+
+  int countInsts(const Rect& area)
+  {
+    std::vector<dbInst*> insts;
+    block_->getSpatialIndex()->findInsts(area, insts);
+    return insts.size();
+  }
+
+  int countShapes(const Rect& area)
+  {
+    std::vector<dbSpatialIndex::Shape> shapes;
+    block_->getSpatialIndex()->findShapes(m1_, area, shapes);
+    return shapes.size();
+  }
+
+  std::unique_ptr<dbDatabase, void (*)(dbDatabase*)> db_;
+  dbTechLayer* m1_;
+  dbMaster* master_;
+  dbBlock* block_;
+};
+
+TEST_F(SpatialIndexTest, IsSharedAndBuiltFromBlock)
+{
+  dbInst* inst = dbInst::create(block_, master_, "u1");
+  inst->setLocation(0, 0);
+  inst->setPlacementStatus(dbPlacementStatus::PLACED);
+  dbInst::create(block_, master_, "unplaced");
+
+  EXPECT_EQ(block_->getSpatialIndex(), block_->getSpatialIndex());
+  EXPECT_EQ(countInsts(Rect(50, 50, 60, 60)), 1);
+  EXPECT_EQ(countInsts(Rect(200, 200, 300, 300)), 0);
+}
+
+TEST_F(SpatialIndexTest, FollowsInstEdits)
+{
+  dbSpatialIndex* index = block_->getSpatialIndex();
+  dbInst* inst = dbInst::create(block_, master_, "u1");
+  inst->setLocation(0, 0);
+  EXPECT_EQ(countInsts(Rect(50, 50, 60, 60)), 0);
+
+  inst->setPlacementStatus(dbPlacementStatus::PLACED);
+  std::vector<dbInst*> insts;
+  index->findInsts(Rect(50, 50, 60, 60), insts);
+  ASSERT_EQ(insts.size(), 1);
+  EXPECT_EQ(insts[0], inst);
+
+  inst->setLocation(1000, 1000);
+  EXPECT_EQ(countInsts(Rect(50, 50, 60, 60)), 0);
+  EXPECT_EQ(countInsts(Rect(1050, 1050, 1060, 1060)), 1);
+
+  dbInst::destroy(inst);
+  EXPECT_EQ(countInsts(Rect(1050, 1050, 1060, 1060)), 0);
+}
+
+TEST_F(SpatialIndexTest, FollowsShapeEdits)
+{
+  block_->getSpatialIndex();
+  dbNet* vdd = dbNet::create(block_, "VDD");
+  dbSWire* swire = dbSWire::create(vdd, dbWireType::ROUTED);
+  dbSBox* sbox
+      = dbSBox::create(swire, m1_, 0, 0, 1000, 100, dbWireShapeType::STRIPE);
+  dbObstruction::create(block_, m1_, 2000, 0, 2100, 100);
+
+  std::vector<dbSpatialIndex::Shape> shapes;
+  block_->getSpatialIndex()->findShapes(m1_, Rect(500, 50, 600, 60), shapes);
+  ASSERT_EQ(shapes.size(), 1);
+  EXPECT_EQ(shapes[0].owner, sbox);
+  EXPECT_EQ(shapes[0].rect, Rect(0, 0, 1000, 100));
+  EXPECT_EQ(countShapes(Rect(0, 0, 3000, 100)), 2);
+
+  dbSWire::destroy(swire);
+  EXPECT_EQ(countShapes(Rect(0, 0, 3000, 100)), 1);
+}
+
+}  // namespace
+}  // namespace odb
@@ -0,0 +1,236 @@
+// Copyright 2024 The Regents of the University of California
+//
+// Use of this source code is governed by a BSD-style
+// license that can be found in the LICENSE file or at
+// https://developers.google.com/open-source/licenses/bsd
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "odb/db.h"
+#include "odb/lefin.h"
+#include "utl/Logger.h"
+
+namespace odb {
+namespace {
+
+class TransactionTest : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    db_ = dbDatabase::create();
+    db_->setLogger(&logger_);
+    lefin lef_reader(db_, &logger_, /*ignore_non_routing_layers=*/false);
+    lib_ = lef_reader.createTechAndLib(
+        "tech", "lib", "data/Nangate45/NangateOpenCellLibrary.mod.lef");
+    dbChip* chip = dbChip::create(db_);
+    block_ = dbBlock::create(chip, "top");
+
+    and_ = lib_->findMaster("AND2_X1");
+    buf_ = lib_->findMaster("BUF_X1");
+    buf2_ = lib_->findMaster("BUF_X2");
+    ASSERT_NE(and_, nullptr);
+    ASSERT_NE(buf_, nullptr);
+    ASSERT_NE(buf2_, nullptr);
+  }
+
+  void TearDown() override { dbDatabase::destroy(db_); }
+
+  utl::Logger logger_;
+  dbDatabase* db_ = nullptr;
+  dbLib* lib_ = nullptr;
+  dbBlock* block_ = nullptr;
+  dbMaster* and_ = nullptr;
+  dbMaster* buf_ = nullptr;
+  dbMaster* buf2_ = nullptr;
+};
+
+TEST_F(TransactionTest, RollbackRemovesCreatedObjects)
+{
+  dbDatabase::beginTransaction(block_);
+  dbInst* inst = dbInst::create(block_, buf_, "b1");
+  dbNet* net = dbNet::create(block_, "n1");
+  inst->findITerm("A")->connect(net);
+  dbBTerm::create(net, "in");
+  dbDatabase::rollbackTransaction(block_);
+
+  EXPECT_EQ(block_->findInst("b1"), nullptr);
+  EXPECT_EQ(block_->findNet("n1"), nullptr);
+  EXPECT_EQ(block_->findBTerm("in"), nullptr);
+  EXPECT_EQ(block_->getInsts().size(), 0);
+  EXPECT_EQ(block_->getITerms().size(), 0);
+  dbDatabase::commitTransaction(block_);
+}
+
+TEST_F(TransactionTest, RollbackRestoresDestroyedObjects)
+{
+  dbInst* inst = dbInst::create(block_, and_, "a1");
+  dbNet* net = dbNet::create(block_, "n1");
+  dbNet* out = dbNet::create(block_, "n2");
+  dbBTerm* bterm = dbBTerm::create(net, "in");
+  bterm->setIoType(dbIoType::INPUT);
+  dbITerm* a1 = inst->findITerm("A1");
+  dbITerm* zn = inst->findITerm("ZN");
+  a1->connect(net);
+  zn->connect(out);
+  inst->setOrient(dbOrientType::MX);
+  inst->setLocation(1000, 2800);
+  inst->setPlacementStatus(dbPlacementStatus::PLACED);
+  const uint inst_id = inst->getId();
+  const uint net_id = net->getId();
+  const uint bterm_id = bterm->getId();
+  const uint a1_id = a1->getId();
+  const uint zn_id = zn->getId();
+  const Rect bbox = inst->getBBox()->getBox();
+
+  dbDatabase::beginTransaction(block_);
+  dbInst::destroy(inst);
+  dbBTerm::destroy(bterm);
+  dbNet::destroy(net);
+  EXPECT_EQ(block_->findInst("a1"), nullptr);
+  dbDatabase::rollbackTransaction(block_);
+  dbDatabase::commitTransaction(block_);
+
+  inst = block_->findInst("a1");
+  net = block_->findNet("n1");
+  bterm = block_->findBTerm("in");
+  ASSERT_NE(inst, nullptr);
+  ASSERT_NE(net, nullptr);
+  ASSERT_NE(bterm, nullptr);
+  EXPECT_EQ(inst->getId(), inst_id);
+  EXPECT_EQ(net->getId(), net_id);
+  EXPECT_EQ(bterm->getId(), bterm_id);
+  EXPECT_EQ(bterm->getNet(), net);
+  EXPECT_EQ(bterm->getIoType(), dbIoType::INPUT);
+  EXPECT_EQ(inst->getMaster(), and_);
+  EXPECT_EQ(inst->findITerm("A1")->getId(), a1_id);
+  EXPECT_EQ(inst->findITerm("ZN")->getId(), zn_id);
+  EXPECT_EQ(inst->findITerm("A1")->getNet(), net);
+  EXPECT_EQ(inst->findITerm("ZN")->getNet(), out);
+  EXPECT_EQ(inst->getOrient(), dbOrientType::MX);
+  EXPECT_EQ(inst->getPlacementStatus(), dbPlacementStatus::PLACED);
+  EXPECT_EQ(inst->getBBox()->getBox(), bbox);
+}
+
+TEST_F(TransactionTest, RollbackToSavepoint)
+{
+  dbInst* inst = dbInst::create(block_, buf_, "b1");
+  inst->setLocation(0, 0);
+
+  dbDatabase::beginTransaction(block_);
+  inst->setLocation(100, 200);
+  const uint savepoint = dbDatabase::transactionSavepoint(block_);
+  inst->setLocation(300, 400);
+  inst->swapMaster(buf2_);
+  dbInst::create(block_, buf_, "b2");
+
+  dbDatabase::rollbackTransaction(block_, savepoint);
+  EXPECT_EQ(block_->findInst("b2"), nullptr);
+  EXPECT_EQ(inst->getMaster(), buf_);
+  EXPECT_EQ(inst->getLocation(), Point(100, 200));
+
+  dbDatabase::rollbackTransaction(block_);
+  EXPECT_EQ(inst->getLocation(), Point(0, 0));
+  dbDatabase::commitTransaction(block_);
+}
+
+TEST_F(TransactionTest, ChangesAfterCommitAreKept)
+{
+  dbDatabase::beginTransaction(block_);
+  dbInst::create(block_, buf_, "b1");
+  dbDatabase::commitTransaction(block_);
+
+  EXPECT_NE(block_->findInst("b1"), nullptr);
+  EXPECT_THROW(dbDatabase::rollbackTransaction(block_), std::runtime_error);
+}
+
+TEST_F(TransactionTest, NestedTransactionIsAnError)
+{
+  dbDatabase::beginTransaction(block_);
+  EXPECT_THROW(dbDatabase::beginTransaction(block_), std::runtime_error);
+  dbDatabase::commitTransaction(block_);
+}
+
+TEST_F(TransactionTest, EcoDuringTransactionIsAnError)
+{
+  dbDatabase::beginTransaction(block_);
+  EXPECT_THROW(dbDatabase::beginEco(block_), std::runtime_error);
+  EXPECT_THROW(dbDatabase::endEco(block_), std::runtime_error);
+  dbDatabase::commitTransaction(block_);
+
+  dbDatabase::beginEco(block_);
+  EXPECT_THROW(dbDatabase::rollbackTransaction(block_), std::runtime_error);
+  EXPECT_THROW(dbDatabase::commitTransaction(block_), std::runtime_error);
+  dbDatabase::endEco(block_);
+}
+
+TEST_F(TransactionTest, RollbackRemovesRenamedObjects)
+{
+  dbDatabase::beginTransaction(block_);
+  dbInst* inst = dbInst::create(block_, buf_, "b1");
+  dbNet* net = dbNet::create(block_, "n1");
+  dbBTerm* bterm = dbBTerm::create(net, "in");
+  inst->findITerm("A")->connect(net);
+  EXPECT_TRUE(inst->rename("b2"));
+  EXPECT_TRUE(net->rename("n2"));
+  EXPECT_TRUE(bterm->rename("in2"));
+  dbDatabase::rollbackTransaction(block_);
+  dbDatabase::commitTransaction(block_);
+
+  EXPECT_EQ(block_->getInsts().size(), 0);
+  EXPECT_EQ(block_->getNets().size(), 0);
+  EXPECT_EQ(block_->getBTerms().size(), 0);
+}
+
+TEST_F(TransactionTest, RollbackRestoresNames)
+{
+  dbInst* inst = dbInst::create(block_, buf_, "b1");
+  dbNet* net = dbNet::create(block_, "n1");
+  dbBTerm* bterm = dbBTerm::create(net, "in");
+
+  dbDatabase::beginTransaction(block_);
+  EXPECT_TRUE(inst->rename("b2"));
+  EXPECT_TRUE(net->rename("n2"));
+  EXPECT_TRUE(bterm->rename("in2"));
+  dbDatabase::rollbackTransaction(block_);
+  dbDatabase::commitTransaction(block_);
+
+  EXPECT_EQ(block_->findInst("b1"), inst);
+  EXPECT_EQ(block_->findNet("n1"), net);
+  EXPECT_EQ(block_->findBTerm("in"), bterm);
+  EXPECT_EQ(block_->findInst("b2"), nullptr);
+  EXPECT_EQ(block_->findNet("n2"), nullptr);
+  EXPECT_EQ(block_->findBTerm("in2"), nullptr);
+}
+
+// An eco replayed on another block recreates and renames the objects.
+TEST_F(TransactionTest, EcoReplaysCreatesAndRenames)
+{
+  dbDatabase::beginEco(block_);
+  dbInst* inst = dbInst::create(block_, buf_, "b1");
+  dbNet* net = dbNet::create(block_, "n1");
+  dbBTerm::create(net, "in");
+  inst->rename("b2");
+  net->rename("n2");
+  dbDatabase::endEco(block_);
+
+  const std::string path = testing::TempDir() + "transaction.eco";
+  dbDatabase::writeEco(block_, path.c_str());
+
+  dbBlock* other = dbBlock::create(db_->getChip()->getBlock(), "other");
+  dbDatabase::readEco(other, path.c_str());
+  dbDatabase::commitEco(other);
+  std::remove(path.c_str());
+
+  EXPECT_NE(other->findInst("b2"), nullptr);
+  EXPECT_NE(other->findNet("n2"), nullptr);
+  EXPECT_NE(other->findBTerm("in"), nullptr);
+  EXPECT_EQ(other->findInst("b1"), nullptr);
+  EXPECT_EQ(other->findNet("n1"), nullptr);
+}
+
+}  // namespace
+}  // namespace odb
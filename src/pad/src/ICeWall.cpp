@@ -35,11 +35,13 @@
 
 #include "pad/ICeWall.h"
 
+#include <algorithm>
 #include <boost/icl/interval_set.hpp>
 
 #include "RDLRouter.h"
 #include "Utilities.h"
 #include "odb/db.h"
+#include "odb/dbSpatialIndex.h"
 #include "odb/dbTransform.h"
 #include "odb/geom.h"
 #include "utl/Logger.h"
@@ -598,7 +600,15 @@ void ICeWall::placeInstance(odb::dbRow* row,
   // check for overlaps
   const odb::Rect inst_rect = inst->getBBox()->getBox();
   auto* block = getBlock();
-  for (auto* check_inst : block->getInsts()) {
+  std::vector<odb::dbInst*> check_insts;
+  block->getSpatialIndex()->findInsts(inst_rect, check_insts);
+  // report the same instance as a scan of the block would
+  std::sort(check_insts.begin(),
+            check_insts.end(),
+            [](odb::dbInst* lhs, odb::dbInst* rhs) {
+              return lhs->getId() < rhs->getId();
+            });
+  for (auto* check_inst : check_insts) {
     if (check_inst == inst) {
       continue;
     }
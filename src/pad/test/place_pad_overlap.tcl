@@ -0,0 +1,41 @@
+# place_pad must refuse a pad that overlaps a placed one, and must see
+# where pads are after they have been moved.
+source "helpers.tcl"
+
+read_lef Nangate45/Nangate45.lef
+read_lef Nangate45_io/dummy_pads.lef
+
+read_def Nangate45_blackparrot/floorplan.def
+
+make_io_sites -horizontal_site IOSITE -vertical_site IOSITE -corner_site IOSITE -offset 15
+
+place_pad -master PADCELL_SIG_V -row IO_EAST -location 500 "IO_EAST_SIDE"
+
+if { ![catch {place_pad -master PADCELL_SIG_V -row IO_EAST -location 510 \
+                "IO_EAST_OVERLAP"} error] } {
+  puts "fail: overlapping pad was placed"
+  exit 1
+}
+if { $error != "PAD-0001" } {
+  puts "fail: unexpected error $error"
+  exit 1
+}
+
+# Abutting is not overlapping.
+if { [catch {place_pad -master PADCELL_SIG_V -row IO_EAST -location 525 \
+               "IO_EAST_OVERLAP"} error] } {
+  puts "fail: abutting pad was not placed: $error"
+  exit 1
+}
+
+# Once moved away, the first pad no longer blocks its old location.
+set inst [[ord::get_db_block] findInst "IO_EAST_SIDE"]
+$inst setPlacementStatus PLACED
+place_pad -row IO_EAST -location 600 "IO_EAST_SIDE"
+if { [catch {place_pad -master PADCELL_SIG_V -row IO_EAST -location 500 \
+               "IO_EAST_MOVED"} error] } {
+  puts "fail: pad overlaps the old location of a moved pad: $error"
+  exit 1
+}
+
+puts "pass"
@@ -24,3 +24,6 @@ record_tests {
   skywater130_caravel
   skywater130_coyote_tc
 }
+record_pass_fail_tests {
+  place_pad_overlap
+}
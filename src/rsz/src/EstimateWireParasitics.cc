@@ -254,7 +254,10 @@ Resizer::updateParasitics()
     parasitics_invalid_.clear();
     break;
   case ParasiticsSrc::global_routing: {
-    incr_groute_->updateRoutes();
+    // Only the nets the router touched and the nets invalidated by
+    // edits need new parasitics; everything else is still current.
+    for (odb::dbNet *db_net : incr_groute_->updateRoutes())
+      parasitics_invalid_.insert(db_network_->dbToSta(db_net));
     for (const Net *net : parasitics_invalid_)
       global_router_->estimateRC(db_network_->staToDb(net));
     parasitics_invalid_.clear();
@@ -296,10 +299,19 @@ Resizer::ensureWireParasitic(const Pin *drvr_pin,
       parasitics_invalid_.erase(net);
       break;
     case ParasiticsSrc::global_routing: {
-      grt::IncrementalGRoute incr_groute(global_router_, block_);
-      global_router_->addDirtyNet(db_network_->staToDb(net));
-      incr_groute.updateRoutes();
-      global_router_->estimateRC(db_network_->staToDb(net));
+      odb::dbNet *db_net = db_network_->staToDb(net);
+      global_router_->addDirtyNet(db_net);
+      if (incr_groute_) {
+        // Nets rerouted along with this one are refreshed by the next
+        // updateParasitics.
+        for (odb::dbNet *rerouted : incr_groute_->updateRoutes())
+          parasitics_invalid_.insert(db_network_->dbToSta(rerouted));
+      }
+      else {
+        grt::IncrementalGRoute incr_groute(global_router_, block_);
+        incr_groute.updateRoutes();
+      }
+      global_router_->estimateRC(db_net);
       parasitics_invalid_.erase(net);
       break;
     }